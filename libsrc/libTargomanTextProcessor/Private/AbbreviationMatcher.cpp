@@ -0,0 +1,202 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QMap>
+#include <limits>
+#include <algorithm>
+
+#include "AbbreviationMatcher.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+AbbreviationMatcher::AbbreviationMatcher() :
+    UseFallback(false),
+    EntryCount(0),
+    RequiredClasses(stuCharClasses::None)
+{
+    this->Nodes.append(stuNode{0, 0, -1});
+}
+
+/**
+ * @brief Builds the trie.
+ * @param _entries abbreviations in priority order.
+ */
+void AbbreviationMatcher::init(const QStringList &_entries)
+{
+    this->EntryCount = _entries.size();
+    this->UseFallback = false;
+    this->Fallback = QRegularExpression();
+    this->RequiredClasses = stuCharClasses::None;
+
+    QStringList Literals;
+    QString Literal;
+    quint16 CommonClasses = stuCharClasses::All;
+    foreach (const QString& Entry, _entries){
+        if (literalOf(Entry, Literal) == false){
+            this->UseFallback = true;
+            break;
+        }
+        Literals.append(Literal);
+        CommonClasses &= stuCharClasses::of(Literal.constData(), Literal.size());
+    }
+
+    if (this->UseFallback){
+        this->Nodes.clear();
+        this->Edges.clear();
+        this->Nodes.append(stuNode{0, 0, -1});
+        this->Fallback = QRegularExpression("\\b(" + _entries.join("|") + ")(?=[^\\w]|$)");
+        this->Fallback.optimize();
+        TargomanLogInfo(5, QString("Abbreviation dictionary is not made of literals, %1 entries compiled as regex").arg(
+                            this->EntryCount));
+        return;
+    }
+
+    // Trie is built using ordered maps and then flattened, so that edges of each node are contiguous and sorted.
+    QVector<QMap<ushort, quint32>> Children(1);
+    QVector<qint32> Ranks(1, -1);
+    for (int Rank = 0; Rank < Literals.size(); ++Rank){
+        quint32 Node = 0;
+        foreach (const QChar& Char, Literals.at(Rank)){
+            quint32 Next = Children[Node].value(Char.unicode(), 0);
+            if (Next == 0){
+                Next = static_cast<quint32>(Children.size());
+                Children[Node].insert(Char.unicode(), Next);
+                Children.append(QMap<ushort, quint32>());
+                Ranks.append(-1);
+            }
+            Node = Next;
+        }
+        if (Ranks[Node] < 0) // Duplicates do not change priority of first occurrence
+            Ranks[Node] = Rank;
+    }
+
+    this->RequiredClasses = Literals.isEmpty() ? stuCharClasses::None : CommonClasses;
+    this->Nodes.resize(Children.size());
+    this->Edges.clear();
+    this->Edges.reserve(Children.size());
+    for (int Node = 0; Node < Children.size(); ++Node){
+        this->Nodes[Node] = stuNode{static_cast<quint32>(this->Edges.size()),
+                                    static_cast<quint32>(Children[Node].size()),
+                                    Ranks[Node]};
+        for (auto Child = Children[Node].constBegin(); Child != Children[Node].constEnd(); ++Child)
+            this->Edges.append(stuEdge{Child.key(), Child.value()});
+    }
+
+    TargomanLogInfo(5, QString("Abbreviation trie has %1 entries and %2 nodes").arg(
+                        this->EntryCount).arg(this->Nodes.size()));
+}
+
+/**
+ * @brief finds first abbreviation in _text starting at or after _from.
+ * @param _length will be set to length of found abbreviation.
+ * @return position of found abbreviation or -1 if not found.
+ */
+int AbbreviationMatcher::find(const QString &_text, int _from, int &_length) const
+{
+    if (this->UseFallback){
+        QRegularExpressionMatch Match = this->Fallback.match(_text, _from);
+        if (Match.hasMatch() == false)
+            return -1;
+        _length = Match.capturedLength();
+        return Match.capturedStart();
+    }
+    if (this->EntryCount == 0)
+        return -1;
+
+    const QChar* Text = _text.constData();
+    int Size = _text.size();
+    for (int Pos = qMax(0, _from); Pos < Size; ++Pos){
+        // \b before abbreviation
+        if ((Pos > 0 && isWordChar(Text[Pos - 1])) == isWordChar(Text[Pos]))
+            continue;
+
+        qint32 BestRank = std::numeric_limits<qint32>::max();
+        int BestLength = 0;
+        qint32 Node = 0;
+        for (int End = Pos; End < Size; ++End){
+            Node = this->child(static_cast<quint32>(Node), Text[End]);
+            if (Node < 0)
+                break;
+            qint32 Rank = this->Nodes.at(Node).Rank;
+            // (?=[^\w]|$) after abbreviation
+            if (Rank >= 0 && Rank < BestRank && (End + 1 == Size || isWordChar(Text[End + 1]) == false)){
+                BestRank = Rank;
+                BestLength = End + 1 - Pos;
+            }
+        }
+        if (BestLength){
+            _length = BestLength;
+            return Pos;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Checks whether an entry is a literal and unescapes it. Escaped non alphanumeric characters are accepted as
+ * literals; any other regular expression syntax is not.
+ */
+bool AbbreviationMatcher::literalOf(const QString &_entry, QString &_literal)
+{
+    static const QString MetaCharacters = QStringLiteral(".^$|?*+()[]{}");
+    _literal.clear();
+    if (_entry.isEmpty())
+        return false;
+    for (int i = 0; i < _entry.size(); ++i){
+        QChar Char = _entry.at(i);
+        if (Char == '\\'){
+            if (++i == _entry.size() || _entry.at(i).isLetterOrNumber())
+                return false;
+            _literal.append(_entry.at(i));
+        }else if (MetaCharacters.contains(Char))
+            return false;
+        else
+            _literal.append(Char);
+    }
+    return true;
+}
+
+/**
+ * @brief returns child of a node by binary search on its edges or -1 if there is no such child.
+ */
+qint32 AbbreviationMatcher::child(quint32 _node, QChar _char) const
+{
+    const stuNode& Node = this->Nodes.at(static_cast<int>(_node));
+    const stuEdge* First = this->Edges.constData() + Node.FirstEdge;
+    const stuEdge* Last = First + Node.EdgeCount;
+    const stuEdge* Edge = std::lower_bound(First, Last, _char.unicode(), [](const stuEdge& _edge, ushort _value){
+        return _edge.Char < _value;
+    });
+    return (Edge != Last && Edge->Char == _char.unicode()) ? static_cast<qint32>(Edge->Node) : -1;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ABBREVIATIONMATCHER_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ABBREVIATIONMATCHER_H
+
+#include <QRegularExpression>
+#include <QStringList>
+#include <QVector>
+
+#include "EntityTagger.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The AbbreviationMatcher class finds abbreviations of a dictionary using a trie which is built once on init.
+ *
+ * Matching is equivalent to \b(entry1|entry2|...)(?=[^\w]|$) with ASCII word characters: an abbreviation must start
+ * at a word boundary and must not be followed by a word character, and when several entries match at the same
+ * position the one which comes first in dictionary wins. Entries are regular expressions which are expected to be
+ * literals with escaped characters (i.e. "Ph\.D\."); if any entry uses other regular expression syntax, the whole
+ * dictionary is compiled to the equivalent regular expression instead.
+ *
+ * After init() the matcher is read-only and can be used by all threads.
+ */
+class AbbreviationMatcher : public intfEntityMatcher
+{
+public:
+    AbbreviationMatcher();
+
+    void init(const QStringList& _entries);
+    inline bool isEmpty() const {return this->EntryCount == 0;}
+    inline bool hasMatch(const QString& _text) const {int Length; return this->find(_text, 0, Length) >= 0;}
+    inline quint16 requiredClasses() const {return this->RequiredClasses;}
+
+    int find(const QString& _text, int _from, INOUT int& _length) const;
+
+private:
+    struct stuNode{
+        quint32 FirstEdge;                              /** < Index of first outgoing edge in Edges.*/
+        quint32 EdgeCount;
+        qint32  Rank;                                   /** < Order of entry which ends at this node in dictionary, -1 if none.*/
+    };
+
+    struct stuEdge{
+        ushort  Char;
+        quint32 Node;
+    };
+
+    static bool literalOf(const QString& _entry, INOUT QString& _literal);
+    static inline bool isWordChar(QChar _char){
+        ushort Char = _char.unicode();
+        return Char < 0x80 && ((Char >= 'a' && Char <= 'z') ||
+                               (Char >= 'A' && Char <= 'Z') ||
+                               (Char >= '0' && Char <= '9') ||
+                               Char == '_');
+    }
+    qint32 child(quint32 _node, QChar _char) const;
+
+private:
+    QVector<stuNode>    Nodes;                          /** < Trie nodes. First node is root.*/
+    QVector<stuEdge>    Edges;                          /** < Outgoing edges of each node sorted by character.*/
+    QRegularExpression  Fallback;                       /** < Used when dictionary is not made of literals.*/
+    bool                UseFallback;
+    int                 EntryCount;
+    quint16             RequiredClasses;                /** < Character classes which are common in all entries.*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ABBREVIATIONMATCHER_H
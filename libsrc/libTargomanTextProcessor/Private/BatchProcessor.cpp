@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <atomic>
+#include <exception>
+#include <QMutex>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QThread>
+
+#include "BatchProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+struct BatchProcessor::stuBatch{
+    std::function<void(int)>    Process;
+    int                         Size;
+    std::atomic<int>            Next;                   /** < Index of next item which is not taken by any worker.*/
+    std::atomic<bool>           Failed;                 /** < Remaining items are skipped once an item has failed.*/
+    QSemaphore                  Done;                   /** < Released once per finished or skipped item.*/
+    QMutex                      ErrorLock;
+    std::exception_ptr          Error;                  /** < First exception thrown by an item.*/
+
+    stuBatch(const std::function<void(int)>& _process, int _size) :
+        Process(_process),
+        Size(_size),
+        Next(0),
+        Failed(false)
+    {}
+
+    void work(){
+        for (int Index = this->Next.fetch_add(1); Index < this->Size; Index = this->Next.fetch_add(1)){
+            if (this->Failed.load(std::memory_order_relaxed) == false){
+                try{
+                    this->Process(Index);
+                }catch(...){
+                    QMutexLocker Locker(&this->ErrorLock);
+                    if (!this->Error)
+                        this->Error = std::current_exception();
+                    this->Failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            this->Done.release();
+        }
+    }
+};
+
+class BatchProcessor::Worker : public QRunnable
+{
+public:
+    Worker(const QSharedPointer<stuBatch>& _batch) : Batch(_batch) {}
+    void run(){ this->Batch->work(); }
+
+private:
+    QSharedPointer<stuBatch> Batch;                     /** < Shared, as a worker may start after caller has returned.*/
+};
+
+class BatchProcessor::Task : public QRunnable
+{
+public:
+    Task(const std::function<void()>& _task) : Function(_task) {}
+    void run(){ this->Function(); }
+
+private:
+    std::function<void()> Function;
+};
+
+BatchProcessor::BatchProcessor()
+{
+    this->Pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+/**
+ * @brief sets number of threads used for batches. Values less than 1 reset it to number of cores.
+ */
+void BatchProcessor::setThreadCount(int _count)
+{
+    this->Pool.setMaxThreadCount(_count > 0 ? _count : QThread::idealThreadCount());
+}
+
+/**
+ * @brief calls _process for each index in [0, _size) and returns when all of them are done. Items run concurrently
+ * and in no particular order, so _process must only write to the slot of its own index.
+ * @exception rethrows first exception thrown by _process after running items have finished. Items which were not
+ * started at that time are skipped.
+ */
+void BatchProcessor::run(int _size, const std::function<void(int)> &_process)
+{
+    if (_size <= 0)
+        return;
+
+    QSharedPointer<stuBatch> Batch(new stuBatch(_process, _size));
+    int Workers = qMin(this->threadCount(), _size) - 1;
+    for (int i = 0; i < Workers; ++i)
+        this->Pool.start(new Worker(Batch));
+
+    Batch->work();
+    Batch->Done.acquire(_size);
+
+    if (Batch->Error)
+        std::rethrow_exception(Batch->Error);
+}
+
+/**
+ * @brief queues _task to be run on pool. _task must not throw.
+ */
+void BatchProcessor::start(const std::function<void()> &_task)
+{
+    this->Pool.start(new Task(_task));
+}
+
+}
+}
+}
+}
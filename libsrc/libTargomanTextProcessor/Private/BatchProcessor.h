@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_BATCHPROCESSOR_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_BATCHPROCESSOR_H
+
+#include <functional>
+#include <QThreadPool>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The BatchProcessor class runs items of a batch on an internal thread pool.
+ *
+ * Items are not divided between workers beforehand. Each worker takes next unprocessed item as soon as it is done with
+ * previous one, so a few long items can not hold back the rest. Calling thread works on the batch too, so batches can
+ * be run from worker threads of pool without waiting for a free thread.
+ */
+class BatchProcessor
+{
+public:
+    static BatchProcessor& instance(){
+        // Initialization of a local static is thread safe, and it is never destroyed as workers may still use it
+        static BatchProcessor* Instance = new BatchProcessor;
+        return *Instance;
+    }
+
+    void setThreadCount(int _count);
+    inline int threadCount() const {return this->Pool.maxThreadCount();}
+
+    void run(int _size, const std::function<void(int)>& _process);
+    void start(const std::function<void()>& _task);
+
+private:
+    struct stuBatch;
+    class Worker;
+    class Task;
+
+private:
+    BatchProcessor();
+    Q_DISABLE_COPY(BatchProcessor)
+
+private:
+    QThreadPool Pool;                                   /** < Private pool, so that batches do not compete with global pool of application.*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_BATCHPROCESSOR_H
@@ -0,0 +1,369 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "CharScanner.h"
+
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TARGOMAN_TP_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * High bytes of blocks which are checked by SIMD kernels.
+ */
+static const quint8 SIMD_BLOCKS[2] = { 0x00 /* ASCII/Latin-1 */, 0x06 /* Arabic */ };
+
+typedef int (*ScanKernel_t)(const CharScanner::stuLookup& _lookup, const quint16* _data, int _size);
+typedef quint16 (*ClassesKernel_t)(const quint16* _data, int _size);
+
+/**
+ * @brief Classes of ASCII code units.
+ */
+static const struct stuASCIIClasses{
+    quint16 Table[0x80];
+    stuASCIIClasses(){
+        memset(this->Table, 0, sizeof(this->Table));
+        for (int Char = '0'; Char <= '9'; ++Char)
+            this->Table[Char] = stuCharClasses::Digit;
+        for (int Char = 'a'; Char <= 'z'; ++Char)
+            this->Table[Char] = this->Table[Char - 'a' + 'A'] = stuCharClasses::Latin;
+        this->Table['@'] = stuCharClasses::At;
+        this->Table['.'] = stuCharClasses::Dot;
+        this->Table[':'] = stuCharClasses::Colon;
+        this->Table['\''] = stuCharClasses::Apostrophe;
+        this->Table['-'] = stuCharClasses::Dash;
+        this->Table['_'] = stuCharClasses::Underscore;
+    }
+} ASCIIClasses;
+
+/**
+ * @brief Portable kernel which checks each code unit against bitmap.
+ */
+static int scanScalar(const CharScanner::stuLookup& _lookup, const quint16* _data, int _size){
+    int i = 0;
+    while (i < _size && (_lookup.Bitmap[_data[i] >> 6] & (Q_UINT64_C(1) << (_data[i] & 63))))
+        ++i;
+    return i;
+}
+
+/**
+ * @brief Portable kernel which looks up class of each code unit. It is also used for tails of SIMD kernels.
+ */
+static quint16 classesScalar(const quint16* _data, int _size){
+    quint16 Classes = stuCharClasses::None;
+    for (const quint16* End = _data + _size; _data < End; ++_data){
+        if (*_data < 0x80)
+            Classes |= ASCIIClasses.Table[*_data];
+        else if ((*_data >> 8) == 0x06)
+            Classes |= stuCharClasses::Arabic;
+    }
+    return Classes;
+}
+
+#ifdef TARGOMAN_TP_X86_SIMD
+/**
+ * @brief Checks 16 code units, which are split to their low and high bytes, against block tables.
+ * @return a bitmask in which each byte is 0xFF if corresponding code unit belongs to the set.
+ */
+__attribute__((target("sse4.2")))
+static inline __m128i matchBlocksSSE42(const CharScanner::stuLookup& _lookup, __m128i _low, __m128i _high){
+    const __m128i NibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i BitSelector = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+    __m128i LowNibbles = _mm_and_si128(_low, NibbleMask);
+    __m128i HighNibbles = _mm_and_si128(_mm_srli_epi16(_low, 4), NibbleMask);
+    __m128i Bits = _mm_shuffle_epi8(BitSelector, HighNibbles);
+    __m128i UseHighRow = _mm_cmpgt_epi8(HighNibbles, _mm_set1_epi8(7));
+
+    __m128i Matched = _mm_setzero_si128();
+    for (int Block = 0; Block < 2; ++Block){
+        __m128i Rows = _mm_blendv_epi8(
+                           _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(_lookup.LowNibbleRows[Block])), LowNibbles),
+                           _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(_lookup.HighNibbleRows[Block])), LowNibbles),
+                           UseHighRow);
+        __m128i InBlock = _mm_cmpeq_epi8(_high, _mm_set1_epi8(static_cast<char>(SIMD_BLOCKS[Block])));
+        Matched = _mm_or_si128(Matched, _mm_and_si128(InBlock, _mm_cmpeq_epi8(_mm_and_si128(Rows, Bits), Bits)));
+    }
+    return Matched;
+}
+
+/**
+ * @brief SSE4.2 kernel which checks 16 code units per iteration. Tail and characters out of SIMD blocks are left to caller.
+ */
+__attribute__((target("sse4.2")))
+static int scanSSE42(const CharScanner::stuLookup& _lookup, const quint16* _data, int _size){
+    const __m128i LowByteMask = _mm_set1_epi16(0x00FF);
+    int i = 0;
+    for (; i + 16 <= _size; i += 16){
+        __m128i First = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i));
+        __m128i Second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i + 8));
+        __m128i Low = _mm_packus_epi16(_mm_and_si128(First, LowByteMask), _mm_and_si128(Second, LowByteMask));
+        __m128i High = _mm_packus_epi16(_mm_srli_epi16(First, 8), _mm_srli_epi16(Second, 8));
+        unsigned Mask = static_cast<unsigned>(_mm_movemask_epi8(matchBlocksSSE42(_lookup, Low, High)));
+        if (Mask != 0xFFFF)
+            return i + __builtin_ctz(~Mask);
+    }
+    return i;
+}
+
+/**
+ * @brief AVX2 kernel which checks 32 code units per iteration. Tail and characters out of SIMD blocks are left to caller.
+ */
+__attribute__((target("avx2")))
+static int scanAVX2(const CharScanner::stuLookup& _lookup, const quint16* _data, int _size){
+    const __m256i LowByteMask = _mm256_set1_epi16(0x00FF);
+    const __m256i NibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i BitSelector = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                                 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i LowRows[2], HighRows[2], BlockIDs[2];
+    for (int Block = 0; Block < 2; ++Block){
+        LowRows[Block] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_lookup.LowNibbleRows[Block])));
+        HighRows[Block] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_lookup.HighNibbleRows[Block])));
+        BlockIDs[Block] = _mm256_set1_epi8(static_cast<char>(SIMD_BLOCKS[Block]));
+    }
+
+    int i = 0;
+    for (; i + 32 <= _size; i += 32){
+        __m256i First = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + i));
+        __m256i Second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + i + 16));
+        // packus works on 128bit lanes so result must be permuted to restore order of code units
+        __m256i Low = _mm256_permute4x64_epi64(
+                          _mm256_packus_epi16(_mm256_and_si256(First, LowByteMask), _mm256_and_si256(Second, LowByteMask)),
+                          _MM_SHUFFLE(3, 1, 2, 0));
+        __m256i High = _mm256_permute4x64_epi64(
+                           _mm256_packus_epi16(_mm256_srli_epi16(First, 8), _mm256_srli_epi16(Second, 8)),
+                           _MM_SHUFFLE(3, 1, 2, 0));
+
+        __m256i LowNibbles = _mm256_and_si256(Low, NibbleMask);
+        __m256i HighNibbles = _mm256_and_si256(_mm256_srli_epi16(Low, 4), NibbleMask);
+        __m256i Bits = _mm256_shuffle_epi8(BitSelector, HighNibbles);
+        __m256i UseHighRow = _mm256_cmpgt_epi8(HighNibbles, _mm256_set1_epi8(7));
+
+        __m256i Matched = _mm256_setzero_si256();
+        for (int Block = 0; Block < 2; ++Block){
+            __m256i Rows = _mm256_blendv_epi8(_mm256_shuffle_epi8(LowRows[Block], LowNibbles),
+                                              _mm256_shuffle_epi8(HighRows[Block], LowNibbles),
+                                              UseHighRow);
+            __m256i InBlock = _mm256_cmpeq_epi8(High, BlockIDs[Block]);
+            Matched = _mm256_or_si256(Matched,
+                                      _mm256_and_si256(InBlock, _mm256_cmpeq_epi8(_mm256_and_si256(Rows, Bits), Bits)));
+        }
+
+        quint32 Mask = static_cast<quint32>(_mm256_movemask_epi8(Matched));
+        if (Mask != 0xFFFFFFFFu)
+            return i + __builtin_ctz(~Mask);
+    }
+    return i;
+}
+
+/**
+ * Matches of each class are accumulated in a separate vector, so each code unit costs a few vector operations and
+ * classes are only extracted once at the end. Ranges are checked as (Char - First) <= (Last - First) using unsigned
+ * minimum, as 16 bit code units above 0x7FFF are negative in signed comparisons.
+ */
+#define TARGOMAN_TP_CLASSES_KERNEL(_target, _bits, _vector, _prefix, _step) \
+__attribute__((target(_target))) \
+static quint16 classes##_bits(const quint16* _data, int _size){ \
+    const _vector DigitFirst = _prefix##_set1_epi16('0'), DigitRange = _prefix##_set1_epi16(9); \
+    const _vector CaseBit = _prefix##_set1_epi16(0x20), LatinFirst = _prefix##_set1_epi16('a'); \
+    const _vector LatinRange = _prefix##_set1_epi16('z' - 'a'), ArabicBlock = _prefix##_set1_epi16(0x06); \
+    _vector Digits = _prefix##_setzero_si##_bits(), Letters = Digits, Arabics = Digits, Ats = Digits, Dots = Digits; \
+    _vector Colons = Digits, Apostrophes = Digits, Dashes = Digits, Underscores = Digits; \
+    int i = 0; \
+    for (; i + _step <= _size; i += _step){ \
+        _vector Chars = _prefix##_loadu_si##_bits(reinterpret_cast<const _vector*>(_data + i)); \
+        _vector Offset = _prefix##_sub_epi16(Chars, DigitFirst); \
+        Digits = _prefix##_or_si##_bits(Digits, _prefix##_cmpeq_epi16(_prefix##_min_epu16(Offset, DigitRange), Offset)); \
+        Offset = _prefix##_sub_epi16(_prefix##_or_si##_bits(Chars, CaseBit), LatinFirst); \
+        Letters = _prefix##_or_si##_bits(Letters, _prefix##_cmpeq_epi16(_prefix##_min_epu16(Offset, LatinRange), Offset)); \
+        Arabics = _prefix##_or_si##_bits(Arabics, _prefix##_cmpeq_epi16(_prefix##_srli_epi16(Chars, 8), ArabicBlock)); \
+        Ats = _prefix##_or_si##_bits(Ats, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16('@'))); \
+        Dots = _prefix##_or_si##_bits(Dots, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16('.'))); \
+        Colons = _prefix##_or_si##_bits(Colons, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16(':'))); \
+        Apostrophes = _prefix##_or_si##_bits(Apostrophes, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16('\''))); \
+        Dashes = _prefix##_or_si##_bits(Dashes, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16('-'))); \
+        Underscores = _prefix##_or_si##_bits(Underscores, _prefix##_cmpeq_epi16(Chars, _prefix##_set1_epi16('_'))); \
+    } \
+    quint16 Classes = classesScalar(_data + i, _size - i); \
+    Classes |= _prefix##_testz_si##_bits(Digits, Digits)           ? 0 : stuCharClasses::Digit; \
+    Classes |= _prefix##_testz_si##_bits(Letters, Letters)         ? 0 : stuCharClasses::Latin; \
+    Classes |= _prefix##_testz_si##_bits(Arabics, Arabics)         ? 0 : stuCharClasses::Arabic; \
+    Classes |= _prefix##_testz_si##_bits(Ats, Ats)                 ? 0 : stuCharClasses::At; \
+    Classes |= _prefix##_testz_si##_bits(Dots, Dots)               ? 0 : stuCharClasses::Dot; \
+    Classes |= _prefix##_testz_si##_bits(Colons, Colons)           ? 0 : stuCharClasses::Colon; \
+    Classes |= _prefix##_testz_si##_bits(Apostrophes, Apostrophes) ? 0 : stuCharClasses::Apostrophe; \
+    Classes |= _prefix##_testz_si##_bits(Dashes, Dashes)           ? 0 : stuCharClasses::Dash; \
+    Classes |= _prefix##_testz_si##_bits(Underscores, Underscores) ? 0 : stuCharClasses::Underscore; \
+    return Classes; \
+}
+
+/**
+ * @brief SSE4.2 kernel which classifies 8 code units per iteration.
+ */
+TARGOMAN_TP_CLASSES_KERNEL("sse4.2", 128, __m128i, _mm, 8)
+
+/**
+ * @brief AVX2 kernel which classifies 16 code units per iteration.
+ */
+TARGOMAN_TP_CLASSES_KERNEL("avx2", 256, __m256i, _mm256, 16)
+#endif
+
+/**
+ * @brief SIMD instruction sets supported by running CPU.
+ */
+enum enuSIMDLevel{
+    SIMDNone,
+    SIMDSSE42,
+    SIMDAVX2
+};
+
+static enuSIMDLevel detectSIMDLevel(){
+#ifdef TARGOMAN_TP_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return SIMDAVX2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return SIMDSSE42;
+#endif
+    return SIMDNone;
+}
+
+/**
+ * @brief Selects best scanning kernel supported by running CPU.
+ */
+static ScanKernel_t selectKernel(){
+    switch (detectSIMDLevel()){
+#ifdef TARGOMAN_TP_X86_SIMD
+    case SIMDAVX2:  return scanAVX2;
+    case SIMDSSE42: return scanSSE42;
+#endif
+    default:        return scanScalar;
+    }
+}
+
+/**
+ * @brief Selects best classifying kernel supported by running CPU.
+ */
+static ClassesKernel_t selectClassesKernel(){
+    switch (detectSIMDLevel()){
+#ifdef TARGOMAN_TP_X86_SIMD
+    case SIMDAVX2:  return classes256;
+    case SIMDSSE42: return classes128;
+#endif
+    default:        return classesScalar;
+    }
+}
+
+CharScanner::CharScanner()
+{
+    this->clear();
+}
+
+/**
+ * @brief removes all code units from the set.
+ */
+void CharScanner::clear()
+{
+    memset(&this->Lookup, 0, sizeof(this->Lookup));
+}
+
+/**
+ * @brief adds a code unit to the set. finalize() must be called after adding all code units.
+ */
+void CharScanner::add(quint16 _codeUnit)
+{
+    this->Lookup.Bitmap[_codeUnit >> 6] |= (Q_UINT64_C(1) << (_codeUnit & 63));
+}
+
+/**
+ * @brief builds lookup tables of SIMD blocks from bitmap.
+ */
+void CharScanner::finalize()
+{
+    memset(this->Lookup.LowNibbleRows, 0, sizeof(this->Lookup.LowNibbleRows));
+    memset(this->Lookup.HighNibbleRows, 0, sizeof(this->Lookup.HighNibbleRows));
+    for (int Block = 0; Block < 2; ++Block)
+        for (int Byte = 0; Byte < 0x100; ++Byte){
+            if (this->contains(static_cast<quint16>((SIMD_BLOCKS[Block] << 8) | Byte)) == false)
+                continue;
+            int HighNibble = Byte >> 4;
+            if (HighNibble < 8)
+                this->Lookup.LowNibbleRows[Block][Byte & 0x0F] |= static_cast<quint8>(1 << HighNibble);
+            else
+                this->Lookup.HighNibbleRows[Block][Byte & 0x0F] |= static_cast<quint8>(1 << (HighNibble - 8));
+        }
+}
+
+/**
+ * @brief finds length of longest prefix of input which all of its code units belong to the set.
+ * @param _data start of input buffer
+ * @param _size size of input buffer
+ * @return number of code units in the prefix.
+ */
+int CharScanner::scan(const QChar* _data, int _size) const
+{
+    static const ScanKernel_t Kernel = selectKernel();
+    const quint16* Data = reinterpret_cast<const quint16*>(_data);
+
+    int i = 0;
+    while (i < _size){
+        i += Kernel(this->Lookup, Data + i, _size - i);
+        // Kernels stop on tails and on code units out of SIMD blocks which are checked here using bitmap
+        if (i >= _size || this->contains(Data[i]) == false)
+            break;
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * @brief returns combination of stuCharClasses::enuClass values of characters in _data.
+ */
+quint16 stuCharClasses::of(const QChar *_data, int _size)
+{
+    static const ClassesKernel_t Kernel = selectClassesKernel();
+    return Kernel(reinterpret_cast<const quint16*>(_data), _size);
+}
+
+/**
+ * @brief same as of() but never uses SIMD kernels. It is kept for comparison in benchmarks.
+ */
+quint16 stuCharClasses::ofScalar(const QChar *_data, int _size)
+{
+    return classesScalar(reinterpret_cast<const quint16*>(_data), _size);
+}
+
+}
+}
+}
+}
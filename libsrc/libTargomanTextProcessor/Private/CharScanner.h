@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_CHARSCANNER_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_CHARSCANNER_H
+
+#include <QChar>
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief Classes of characters which are present in a phrase.
+ *
+ * Stages of tagging only remove characters or insert spaces and placeholders, so classes found in normalized phrase
+ * are a superset of classes of phrase before each stage, and a stage which requires a class which was not found can
+ * be skipped without changing the result. Classes are found 8 or 16 code units at a time by SSE4.2 or AVX2 kernels
+ * when running CPU supports them.
+ */
+struct stuCharClasses{
+    enum enuClass{
+        None       = 0x0000,
+        Digit      = 0x0001,                            /** < ASCII digits.*/
+        Latin      = 0x0002,                            /** < ASCII letters.*/
+        Arabic     = 0x0004,                            /** < Characters of Arabic block (U+0600 to U+06FF).*/
+        At         = 0x0008,
+        Dot        = 0x0010,
+        Colon      = 0x0020,
+        Apostrophe = 0x0040,
+        Dash       = 0x0080,
+        Underscore = 0x0100,
+        All        = 0xFFFF
+    };
+
+    static quint16 of(const QChar* _data, int _size);
+    static quint16 ofScalar(const QChar* _data, int _size);
+    static inline bool hasAll(quint16 _classes, quint16 _required){return (_classes & _required) == _required;}
+};
+
+/**
+ * @brief Finds maximal runs of UTF-16 code units which belong to a predefined set.
+ *
+ * Membership of whole BMP is kept in a bitmap. Besides that two 256 character blocks (ASCII/Latin-1 and Arabic),
+ * which cover most of input text, are compiled to nibble lookup tables so that they can be checked 16 or 32 code
+ * units at a time using SSE4.2 or AVX2. Best available implementation is selected at runtime and scalar bitmap
+ * lookup is used when no SIMD support is available.
+ */
+class CharScanner
+{
+public:
+    /**
+     * @brief Lookup tables used by scanning kernels.
+     */
+    struct stuLookup{
+        alignas(32) quint8 LowNibbleRows[2][16];        /** < Bit n of entry L is set if (n << 4 | L) belongs to the block.*/
+        alignas(32) quint8 HighNibbleRows[2][16];       /** < Bit n of entry L is set if ((n + 8) << 4 | L) belongs to the block.*/
+        quint64            Bitmap[0x10000 / 64];        /** < Membership of all BMP code units.*/
+    };
+
+public:
+    CharScanner();
+
+    void clear();
+    void add(quint16 _codeUnit);
+    void finalize();
+
+    /**
+     * @brief checks whether a code unit belongs to the set or not.
+     */
+    inline bool contains(quint16 _codeUnit) const{
+        return this->Lookup.Bitmap[_codeUnit >> 6] & (Q_UINT64_C(1) << (_codeUnit & 63));
+    }
+
+    int scan(const QChar* _data, int _size) const;
+
+private:
+    stuLookup Lookup;                                   /** < Lookup tables of the set.*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_CHARSCANNER_H
@@ -0,0 +1,252 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QScopedPointer>
+
+#include "EntityTagger.h"
+#include "PipelineStats.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief returns value of next entity of _kind and advances its cursor.
+ * @return value of entity or an empty string if there is no more entities of _kind.
+ */
+QString stuTaggedEntities::takeNext(enuKind _kind, stuCursors &_cursors) const
+{
+    int& Cursor = _cursors.Next[_kind];
+    while (Cursor < this->Spans.size()){
+        const stuSpan& Span = this->Spans.at(Cursor++);
+        if (Span.Kind == _kind)
+            return this->Values.mid(static_cast<int>(Span.Offset), static_cast<int>(Span.Length));
+    }
+    return QString();
+}
+
+EntityTagger::EntityTagger()
+{}
+
+/**
+ * @brief Removes all stages.
+ */
+void EntityTagger::clear()
+{
+    this->Stages.clear();
+}
+
+/**
+ * @brief Appends a stage which replaces each match of _regex with placeholder of _kind and stores its value.
+ * @param _regex pattern to search for.
+ * @param _kind kind of entities found by this stage.
+ * @param _name name of stage in debug logs.
+ * @param _capID id of group in regular expression which holds value. If it is 2, first group is kept in phrase.
+ * @param _requiredClasses classes of characters which are present in all matches of _regex.
+ */
+void EntityTagger::addMarkingStage(const QRegularExpression &_regex,
+                                   stuTaggedEntities::enuKind _kind,
+                                   const char *_name,
+                                   quint8 _capID,
+                                   quint16 _requiredClasses)
+{
+    stuStage Stage;
+    Stage.Regex = _regex;
+    Stage.Regex.optimize();
+    Stage.Matcher = nullptr;
+    Stage.Name = _name;
+    Stage.StageID = PipelineStats::instance().registerStage(Stage.Name);
+    Stage.Replacement = QString(" %1 ").arg(stuTaggedEntities::placeholder(_kind));
+    Stage.Kind = _kind;
+    Stage.CapID = _capID;
+    Stage.RequiredClasses = _requiredClasses;
+    Stage.IsRewriting = false;
+    this->Stages.append(Stage);
+}
+
+/**
+ * @brief Appends a stage which replaces each entity found by _matcher with placeholder of _kind and stores its value.
+ * @param _matcher matcher which must be kept alive and unchanged as long as this tagger is used.
+ * @param _requiredClasses classes of characters which are present in all entities found by _matcher.
+ */
+void EntityTagger::addMarkingStage(const intfEntityMatcher *_matcher,
+                                   stuTaggedEntities::enuKind _kind,
+                                   const char *_name,
+                                   quint16 _requiredClasses)
+{
+    stuStage Stage;
+    Stage.Matcher = _matcher;
+    Stage.Name = _name;
+    Stage.StageID = PipelineStats::instance().registerStage(Stage.Name);
+    Stage.Replacement = QString(" %1 ").arg(stuTaggedEntities::placeholder(_kind));
+    Stage.Kind = _kind;
+    Stage.CapID = 0;
+    Stage.RequiredClasses = _requiredClasses;
+    Stage.IsRewriting = false;
+    this->Stages.append(Stage);
+}
+
+/**
+ * @brief Appends a stage which replaces all matches of _regex with _after. Back references can be used in _after.
+ */
+void EntityTagger::addRewritingStage(const QRegularExpression &_regex,
+                                     const QString &_after,
+                                     const char *_name,
+                                     quint16 _requiredClasses)
+{
+    stuStage Stage;
+    Stage.Regex = _regex;
+    Stage.Regex.optimize();
+    Stage.Matcher = nullptr;
+    Stage.Name = _name;
+    Stage.StageID = PipelineStats::instance().registerStage(Stage.Name);
+    Stage.Replacement = _after;
+    Stage.Kind = stuTaggedEntities::KindCount;
+    Stage.CapID = 0;
+    Stage.RequiredClasses = _requiredClasses;
+    Stage.IsRewriting = true;
+    this->Stages.append(Stage);
+}
+
+/**
+ * @brief Runs all stages on _phrase in order.
+ * @param _phrase phrase to be tagged. Found entities will be replaced by their markers.
+ * @param _entities values of found entities will be appended to this struct.
+ * @param _map if provided, it is updated along with _phrase. Placeholders map to span of their whole entity.
+ * @param _classes classes of characters which are present in _phrase. Stages which require other classes are skipped.
+ * @param _skippedKinds combination of stuTaggedEntities::kindMask() of entities which must not be detected.
+ */
+void EntityTagger::tag(QString &_phrase,
+                       stuTaggedEntities &_entities,
+                       SourceMap* _map,
+                       quint16 _classes,
+                       quint32 _skippedKinds) const
+{
+    QString Spare;
+    SourceMap SpareMap;
+    foreach (const stuStage& Stage, this->Stages){
+        if (stuCharClasses::hasAll(_classes, Stage.RequiredClasses) == false ||
+            (Stage.IsRewriting == false && (_skippedKinds & stuTaggedEntities::kindMask(Stage.Kind)))){
+            PipelineStats::instance().recordSkip(Stage.StageID);
+            TargomanDebug(7,"["<<Stage.Name<<"] skipped");
+            continue;
+        }
+
+        StageTimer Timer(Stage.StageID);
+        if (Stage.IsRewriting){
+            int SizeBefore = _phrase.size();
+            SourceMap::replace(_phrase, Stage.Regex, Stage.Replacement, _map);
+            Timer.finish(_phrase.size() != SizeBefore);
+            TargomanDebug(7,"["<<Stage.Name<<"] |"<<_phrase<<"|");
+            continue;
+        }
+
+        QRegularExpressionMatch Match;
+        QScopedPointer<intfEntityMatcher::intfState> State(Stage.Matcher ? Stage.Matcher->newState() : nullptr);
+        int Length = 0;
+        int Pos = this->find(Stage, _phrase, 0, Match, Length, State.data());
+        if (Pos < 0){
+            Timer.finish();
+            TargomanDebug(7,"["<<Stage.Name<<"] |"<<_phrase<<"|");
+            continue;
+        }
+
+        Spare.clear();
+        Spare.reserve(_phrase.size() + 16);
+        if (_map){
+            SpareMap.clear();
+            SpareMap.reserve(_phrase.size() + 16);
+        }
+        int Start = 0;
+        quint64 Matches = 0;
+        do{
+            ++Matches;
+            int ValueStart = Pos, ValueLength = Length;
+            if (Stage.Matcher || Stage.CapID == 0)
+                _entities.append(Stage.Kind, _phrase.constData() + Pos, Length);
+            else{
+                ValueStart = Match.capturedStart(Stage.CapID);
+                ValueLength = Match.capturedLength(Stage.CapID);
+                _entities.append(Stage.Kind, Match.captured(Stage.CapID));
+            }
+            Spare.append(_phrase.constData() + Start, Pos - Start);
+            Spare.append(' ');
+            if (Stage.CapID == 2)
+                Spare.append(Match.captured(1));
+            Spare.append(Stage.Replacement);
+            if (_map){
+                SpareMap.appendCopy(*_map, Start, Pos - Start);
+                SpareMap.append(stuSourceSpan());
+                if (Stage.CapID == 2 && Match.capturedStart(1) >= 0)
+                    SpareMap.appendCopy(*_map, Match.capturedStart(1), Match.capturedLength(1));
+                SpareMap.append(stuSourceSpan());
+                SpareMap.append(ValueStart < 0 ? stuSourceSpan() : _map->span(ValueStart, ValueLength));
+                SpareMap.append(stuSourceSpan());
+            }
+            Start = Pos + Length;
+            Pos = this->find(Stage, _phrase, Start, Match, Length, State.data());
+        }while(Pos >= 0);
+        Spare.append(_phrase.constData() + Start, _phrase.size() - Start);
+        if (_map){
+            SpareMap.appendCopy(*_map, Start, _phrase.size() - Start);
+            qSwap(*_map, SpareMap);
+        }
+        qSwap(_phrase, Spare);
+        Timer.finish(Matches);
+
+        TargomanDebug(7,"["<<Stage.Name<<"] |"<<_phrase<<"|");
+    }
+}
+
+/**
+ * @brief finds next entity of a stage using its matcher or its regular expression.
+ * @param _match will be filled with regular expression match when stage has no matcher.
+ * @param _length will be set to length of found entity.
+ * @param _state state of stage matcher which is kept between searches on the same phrase.
+ * @return position of found entity or -1 if not found.
+ */
+int EntityTagger::find(const stuStage& _stage,
+                       const QString& _phrase,
+                       int _from,
+                       QRegularExpressionMatch& _match,
+                       int& _length,
+                       intfEntityMatcher::intfState* _state) const
+{
+    if (_stage.Matcher)
+        return _stage.Matcher->find(_phrase, _from, _length, _state);
+
+    _match = _stage.Regex.match(_phrase, _from);
+    if (_match.hasMatch() == false)
+        return -1;
+    _length = _match.capturedLength();
+    return _match.capturedStart();
+}
+
+}
+}
+}
+}
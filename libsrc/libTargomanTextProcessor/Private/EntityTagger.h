@@ -0,0 +1,202 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ENTITYTAGGER_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ENTITYTAGGER_H
+
+#include <QRegularExpression>
+#include <QStringList>
+#include <QVector>
+
+#include "../TextProcessor.h"
+#include "CharScanner.h"
+#include "SourceMap.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+#define ENTITY_PLACEHOLDER_BASE 0xE000
+
+/**
+ * @brief Entities found in a phrase.
+ *
+ * Each entity is replaced in the phrase by a single private use character which identifies its kind, and its value
+ * is appended to a shared buffer and addressed by a span. As normalizer replaces all private use characters, these
+ * placeholders can not be confused with input text. Placeholders are resolved in order of their appearance using a
+ * cursor per kind.
+ */
+struct stuTaggedEntities{
+    enum enuKind{
+        Email,
+        URL,
+        Abbreviation,
+        Date,
+        Time,
+        Ordinal,
+        SpecialNumber,
+        NumberLeft,                                     /** < Numbers that were in left side of a word.*/
+        NumberRight,                                    /** < Numbers that were in right side of a word.*/
+        Suffix,
+        OrderedItem,
+        Symbol,
+        MultiDot,
+        KindCount
+    };
+
+    struct stuSpan{
+        quint32 Offset;                                 /** < Offset of value in Values.*/
+        quint32 Length;
+        quint8  Kind;
+    };
+
+    /**
+     * @brief Cursors of next unresolved span of each kind.
+     */
+    struct stuCursors{
+        int Next[KindCount] = {0};
+    };
+
+    QString             Values;                         /** < Values of all entities back to back.*/
+    QVector<stuSpan>    Spans;                          /** < Entities in order of detection.*/
+
+    static inline QChar placeholder(enuKind _kind){return QChar(ENTITY_PLACEHOLDER_BASE + _kind);}
+    static inline quint32 kindMask(enuKind _kind){return 1u << _kind;}
+    static inline bool isPlaceholder(QChar _char){
+        return _char.unicode() >= ENTITY_PLACEHOLDER_BASE && _char.unicode() < ENTITY_PLACEHOLDER_BASE + KindCount;
+    }
+
+    inline void append(enuKind _kind, const QChar* _value, int _length){
+        this->Spans.append(stuSpan{static_cast<quint32>(this->Values.size()),
+                                   static_cast<quint32>(_length),
+                                   static_cast<quint8>(_kind)});
+        this->Values.append(_value, _length);
+    }
+    inline void append(enuKind _kind, const QString& _value){this->append(_kind, _value.constData(), _value.size());}
+
+    QString takeNext(enuKind _kind, INOUT stuCursors& _cursors) const;
+};
+
+/**
+ * @brief The intfEntityMatcher class is an interface for hand written entity matchers which can be used as a tagging
+ * stage instead of a regular expression. Matchers must be read-only after being initialized.
+ */
+class intfEntityMatcher
+{
+public:
+    /**
+     * @brief State of a search which matchers keep between calls of find() on the same text, so that parts of text
+     * scanned by previous calls are not scanned again. It is created by newState() and owned by caller.
+     */
+    class intfState
+    {
+    public:
+        virtual ~intfState(){}
+    };
+
+public:
+    virtual ~intfEntityMatcher(){}
+    /**
+     * @brief returns a new state for searching a text or nullptr if matcher does not keep any state.
+     */
+    virtual intfState* newState() const {return nullptr;}
+    /**
+     * @brief finds first entity in _text starting at or after _from.
+     * @param _length will be set to length of found entity.
+     * @param _state state returned by newState() which has only been used on the same text, or nullptr.
+     * @return position of found entity or -1 if there is no more entities.
+     */
+    virtual int find(const QString& _text, int _from, INOUT int& _length, intfState* _state) const = 0;
+};
+
+/**
+ * @brief The EntityTagger class holds entity detection stages of IXMLWriter compiled in their priority order.
+ *
+ * Stages are compiled once on init and are only read afterwards, so a single tagger is shared by all threads. Each
+ * stage scans output of previous stages, as later patterns depend on spaces and placeholders inserted by earlier ones,
+ * and writes into a reused spare buffer which is swapped with the phrase instead of building a new string by
+ * concatenating parts of each match.
+ *
+ * Stages are registered in PipelineStats by their names and their time and number of matches are recorded while
+ * profiling is active.
+ */
+class EntityTagger
+{
+public:
+    EntityTagger();
+
+    void clear();
+    void addMarkingStage(const QRegularExpression& _regex,
+                         stuTaggedEntities::enuKind _kind,
+                         const char* _name,
+                         quint8 _capID = 0,
+                         quint16 _requiredClasses = stuCharClasses::None);
+    void addMarkingStage(const intfEntityMatcher* _matcher,
+                         stuTaggedEntities::enuKind _kind,
+                         const char* _name,
+                         quint16 _requiredClasses = stuCharClasses::None);
+    void addRewritingStage(const QRegularExpression& _regex,
+                           const QString& _after,
+                           const char* _name,
+                           quint16 _requiredClasses = stuCharClasses::None);
+
+    void tag(INOUT QString& _phrase,
+             INOUT stuTaggedEntities& _entities,
+             SourceMap* _map = nullptr,
+             quint16 _classes = stuCharClasses::All,
+             quint32 _skippedKinds = 0) const;
+
+private:
+    struct stuStage{
+        QRegularExpression Regex;
+        const intfEntityMatcher* Matcher;               /** < Used instead of Regex when it is not nullptr.*/
+        QString Name;                                   /** < Name of stage in debug logs.*/
+        QString Replacement;                            /** < Placeholder of found entities or replacement of rewriting stages.*/
+        stuTaggedEntities::enuKind Kind;
+        quint8 CapID;                                   /** < Captured group which holds value of entity.*/
+        quint16 RequiredClasses;                        /** < Stage is skipped when any of these classes is not in phrase.*/
+        int StageID;                                    /** < Id of stage in PipelineStats.*/
+        bool IsRewriting;
+    };
+
+    int find(const stuStage& _stage,
+             const QString& _phrase,
+             int _from,
+             INOUT QRegularExpressionMatch& _match,
+             INOUT int& _length,
+             intfEntityMatcher::intfState* _state) const;
+
+private:
+    QVector<stuStage> Stages;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_ENTITYTAGGER_H
@@ -0,0 +1,384 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QStringList>
+
+#include "IXMLReader.h"
+#include "IXMLWriter.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+static const QStringList& supportedSuffixes()
+{
+    static QStringList Suffixes = IXMLWriter::supportedSuffixes().split('|');
+    return Suffixes;
+}
+
+/**
+ * @brief whether the space before a token starting with this character is removed when detokenizing.
+ */
+static inline bool attachesToPrevious(QChar _char)
+{
+    switch (_char.unicode()){
+    case '.': case ',': case ';': case ':': case '?': case '!': case ')':
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief whether the space after a token ending with this character is removed when detokenizing.
+ */
+static inline bool attachesToNext(QChar _char)
+{
+    return _char == '(' || _char == ')';
+}
+
+/**
+ * @brief returns rank of a sentence end or 0 for other characters.
+ */
+static inline int terminatorRank(QChar _char)
+{
+    switch (_char.unicode()){
+    case '.': return 1;
+    case '?': return 2;
+    case '!': return 3;
+    default:  return 0;
+    }
+}
+
+static inline bool isASCIILetter(QChar _char)
+{
+    return (_char >= 'a' && _char <= 'z') || (_char >= 'A' && _char <= 'Z');
+}
+
+IXMLReader::IXMLReader(bool _detokenize, bool _hinidiDigits, bool _arabicPunctuations, bool _breakSentences) :
+    Detokenize(_detokenize),
+    HinidiDigits(_hinidiDigits),
+    ArabicPunctuations(_arabicPunctuations),
+    BreakSentences(_breakSentences),
+    SentenceRawTokens(0),
+    SentenceQuotes(NoQuote),
+    LineSentences(0)
+{}
+
+/**
+ * @brief converts ixml text to plain text. Empty lines are skipped and sentences of each line are separated by new
+ * line if sentences must be broken or by space otherwise.
+ */
+QString IXMLReader::convert2Text(const QString &_ixml)
+{
+    const QChar* Data = _ixml.constData();
+    int Size = _ixml.size();
+
+    this->Output.reserve(Size);
+    bool FirstLine = true;
+    int Pos = 0;
+    while (Pos < Size){
+        if (Data[Pos] == '\n'){
+            ++Pos;
+            continue;
+        }
+        if (FirstLine == false)
+            this->Output.append('\n');
+        FirstLine = false;
+        Pos = this->readLine(Data, Size, Pos);
+    }
+    return this->Output;
+}
+
+/**
+ * @brief reads tokens of a line, splits it to sentences and writes them to output.
+ *
+ * ". ." is read as "..". A stand-alone '.', '?' or '!' ends the sentence when another token follows it. If that token
+ * starts with a closing quote or bracket, the closing character is kept in the ending sentence and is attached to a
+ * dot. A dot followed by "&gt;" does not end the sentence and is attached to it. A sentence end at start of line or
+ * right after another one is only a sentence by itself if it has lower rank ('.' < '?' < '!') than the previous one,
+ * as they used to be broken in this order, or if the previous one was followed by a closing token.
+ * @return position of end of line.
+ */
+int IXMLReader::readLine(const QChar *_data, int _size, int _pos)
+{
+    this->RawTokens.resize(0);
+    int Pos = _pos;
+    int LastEnd = -1;
+    while (Pos < _size && _data[Pos] != '\n'){
+        if (_data[Pos] == ' '){
+            ++Pos;
+            continue;
+        }
+        int Start = Pos;
+        while (Pos < _size && _data[Pos] != ' ' && _data[Pos] != '\n')
+            ++Pos;
+        stuRawToken Raw;
+        Raw.Start = Start;
+        Raw.Length = Pos - Start;
+        Raw.Merged = LastEnd > 0 && Start == LastEnd + 1 && _data[Start] == '.' && _data[LastEnd - 1] == '.';
+        this->RawTokens.append(Raw);
+        LastEnd = Pos;
+    }
+
+    this->LineSentences = 0;
+    int PreviousRank = terminatorRank('.');             // rank of the token which ended previous sentence
+    for (int i = 0; i < this->RawTokens.size(); ++i){
+        const stuRawToken& Raw = this->RawTokens.at(i);
+        const QChar* Token = _data + Raw.Start;
+        this->appendToken(Token,
+                          Raw.Length,
+                          Raw.Merged || (this->SentenceRawTokens && isSuffix(Token, Raw.Length)));
+        ++this->SentenceRawTokens;
+
+        if (Raw.Length != 1 ||
+            Raw.Merged ||
+            (this->SentenceRawTokens == 1 && terminatorRank(Token[0]) >= PreviousRank) ||
+            i + 1 == this->RawTokens.size() ||
+            this->RawTokens.at(i + 1).Merged)
+            continue;
+        QChar Terminator = Token[0];
+        if (terminatorRank(Terminator) == 0)
+            continue;
+
+        const stuRawToken& Next = this->RawTokens.at(i + 1);
+        const QChar* NextToken = _data + Next.Start;
+        if (NextToken[0] == '"' || NextToken[0] == ')' || NextToken[0] == ']' || NextToken[0] == '}'){
+            this->appendToken(NextToken, 1, Terminator == '.');
+            this->writeSentence();
+            ++i;
+            PreviousRank = Next.Length == 1 ? terminatorRank('!') + 1 : terminatorRank('.');
+            if (Next.Length > 1){
+                this->appendToken(NextToken + 1, Next.Length - 1, false);
+                this->SentenceRawTokens = 1;
+            }
+        }else if (Terminator == '.' &&
+                  Next.Length >= 4 &&
+                  NextToken[0] == '&' &&
+                  NextToken[1] == 'g' &&
+                  NextToken[2] == 't' &&
+                  NextToken[3] == ';')
+            this->RawTokens[i + 1].Merged = true;
+        else{
+            this->writeSentence();
+            PreviousRank = terminatorRank(Terminator);
+        }
+    }
+    this->writeSentence();
+    return Pos;
+}
+
+/**
+ * @brief copies a token to current sentence removing its ixml tags and unescaping "&gt;", "&lt;" and "&amp;". Tokens
+ * which are empty after removing tags are dropped.
+ * @param _glued whether token must be written right after previous one.
+ */
+void IXMLReader::appendToken(const QChar *_token, int _length, bool _glued)
+{
+    int Start = this->SentenceText.size();
+    quint8 Quotes = NoQuote;
+    for (int i = 0; i < _length; ++i){
+        QChar Char = _token[i];
+        if (Char == '<'){
+            int TagLength = ixmlTagLength(_token + i, _length - i);
+            if (TagLength){
+                i += TagLength - 1;
+                continue;
+            }
+        }else if (Char == '&' && i + 3 < _length){
+            if ((_token[i + 1] == 'g' || _token[i + 1] == 'l') && _token[i + 2] == 't' && _token[i + 3] == ';'){
+                this->SentenceText.append(_token[i + 1] == 'g' ? '>' : '<');
+                i += 3;
+                continue;
+            }
+            if (i + 4 < _length &&
+                _token[i + 1] == 'a' &&
+                _token[i + 2] == 'm' &&
+                _token[i + 3] == 'p' &&
+                _token[i + 4] == ';'){
+                this->SentenceText.append('&');
+                i += 4;
+                continue;
+            }
+        }
+        if (Char == '"')
+            Quotes |= DoubleQuote;
+        else if (Char == '\'')
+            Quotes |= SingleQuote;
+        this->SentenceText.append(Char);
+    }
+
+    if (this->SentenceText.size() == Start)
+        return;
+    stuToken Token;
+    Token.Start = Start;
+    Token.Length = this->SentenceText.size() - Start;
+    Token.Glued = _glued;
+    Token.Quotes = Quotes;
+    this->Tokens.append(Token);
+    if (Token.Length == 1)
+        this->SentenceQuotes |= Quotes;
+}
+
+/**
+ * @brief attaches pairs of stand-alone quotes to the tokens which they enclose.
+ *
+ * Tokens which are glued together are checked as a group. Groups are scanned once, using quote flags of tokens
+ * instead of their text, and a stand-alone quote is paired with the next stand-alone quote if at least one group is
+ * between them and none of groups between them contain the quote character. Paired quotes are not reused, so results
+ * are the same as repeatedly replacing leftmost match of (?:(?: |^)" )([^"]+)(?: "(?: |$)) with " \"\\1\" " which
+ * was quadratic on lines with many quotes.
+ */
+void IXMLReader::pairQuotes(enuQuote _quote)
+{
+    int Open = -1;
+    bool HasContent = false;
+    int GroupStart = 0;
+    while (GroupStart < this->Tokens.size()){
+        quint8 GroupQuotes = this->Tokens.at(GroupStart).Quotes;
+        int GroupEnd = GroupStart + 1;
+        while (GroupEnd < this->Tokens.size() && this->Tokens.at(GroupEnd).Glued)
+            GroupQuotes |= this->Tokens.at(GroupEnd++).Quotes;
+
+        if ((GroupQuotes & _quote) == 0)
+            HasContent = true;
+        else if (GroupEnd == GroupStart + 1 && this->Tokens.at(GroupStart).Length == 1){
+            if (Open >= 0 && HasContent){
+                this->Tokens[Open + 1].Glued = true;
+                this->Tokens[GroupStart].Glued = true;
+                Open = -1;
+            }else{
+                Open = GroupStart;
+                HasContent = false;
+            }
+        }else
+            Open = -1;
+        GroupStart = GroupEnd;
+    }
+}
+
+/**
+ * @brief writes tokens of current sentence to output and clears it. Detokenization removes space before closing
+ * punctuations and brackets and after brackets.
+ */
+void IXMLReader::writeSentence()
+{
+    static const QString ArabicCharacters = QStringLiteral("۰۱۲۳۴۵۶۷۸۹؟؛،");
+
+    if (this->SentenceRawTokens == 0)
+        return;
+    if (this->LineSentences++)
+        this->Output.append(this->BreakSentences ? '\n' : ' ');
+
+    if (this->Detokenize){
+        if (this->SentenceQuotes & DoubleQuote)
+            this->pairQuotes(DoubleQuote);
+        if (this->SentenceQuotes & SingleQuote)
+            this->pairQuotes(SingleQuote);
+    }
+
+    const QChar* Text = this->SentenceText.constData();
+    for (int i = 0; i < this->Tokens.size(); ++i){
+        const stuToken& Token = this->Tokens.at(i);
+        const QChar* Data = Text + Token.Start;
+        if (i &&
+            Token.Glued == false &&
+            (this->Detokenize == false || (attachesToPrevious(Data[0]) == false && attachesToNext(Data[-1]) == false)))
+            this->Output.append(' ');
+
+        if (this->HinidiDigits == false && this->ArabicPunctuations == false){
+            this->Output.append(Data, Token.Length);
+            continue;
+        }
+        for (int j = 0; j < Token.Length; ++j){
+            QChar Char = Data[j];
+            if (this->HinidiDigits && Char >= '0' && Char <= '9')
+                Char = ArabicCharacters.at(Char.unicode() - '0');
+            else if (this->ArabicPunctuations)
+                switch (Char.unicode()){
+                case ';': Char = ArabicCharacters.at(10); break;
+                case '?': Char = ArabicCharacters.at(11); break;
+                case ',': Char = ArabicCharacters.at(12); break;
+                }
+            this->Output.append(Char);
+        }
+    }
+
+    this->Tokens.resize(0);
+    this->SentenceText.resize(0);
+    this->SentenceRawTokens = 0;
+    this->SentenceQuotes = NoQuote;
+}
+
+/**
+ * @brief returns length of the ixml tag at start of _data or 0 if it does not start with an ixml tag. Tag names are
+ * matched case insensitively and may have an index as in <number-1>.
+ */
+int IXMLReader::ixmlTagLength(const QChar *_data, int _size)
+{
+    static const QStringList TagNames = enuTextTags::options();
+
+    int Pos = 1;
+    if (Pos < _size && _data[Pos] == '/')
+        ++Pos;
+    int NameStart = Pos;
+    while (Pos < _size && isASCIILetter(_data[Pos]))
+        ++Pos;
+    int NameLength = Pos - NameStart;
+    if (NameLength == 0)
+        return 0;
+    if (Pos < _size && _data[Pos] == '-'){
+        int IndexStart = ++Pos;
+        while (Pos < _size && _data[Pos] >= '0' && _data[Pos] <= '9')
+            ++Pos;
+        if (Pos == IndexStart)
+            return 0;
+    }
+    if (Pos >= _size || _data[Pos] != '>')
+        return 0;
+
+    QString Name = QString::fromRawData(_data + NameStart, NameLength);
+    foreach (const QString& TagName, TagNames)
+        if (TagName.compare(Name, Qt::CaseInsensitive) == 0)
+            return Pos + 1;
+    return 0;
+}
+
+/**
+ * @brief whether token is a suffix like 's which is attached to previous token.
+ */
+bool IXMLReader::isSuffix(const QChar *_token, int _length)
+{
+    return _length > 1 &&
+            _token[0] == '\'' &&
+            supportedSuffixes().contains(QString::fromRawData(_token + 1, _length - 1));
+}
+
+}
+}
+}
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREADER_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREADER_H
+
+#include <QString>
+#include <QVector>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The IXMLReader class converts ixml text back to plain text.
+ *
+ * Each line is walked once: its tokens are found, sentence breaks are decided and tags are removed and entities are
+ * unescaped while tokens are copied to a sentence buffer. When a sentence is complete, its quotes are paired and its
+ * tokens are written to output with or without a space between them, so that no pass over the whole text is repeated.
+ *
+ * A reader is created per call and must not be shared between threads.
+ */
+class IXMLReader
+{
+public:
+    IXMLReader(bool _detokenize, bool _hinidiDigits, bool _arabicPunctuations, bool _breakSentences);
+
+    QString convert2Text(const QString& _ixml);
+
+private:
+    enum enuQuote{
+        NoQuote     = 0x00,
+        DoubleQuote = 0x01,
+        SingleQuote = 0x02
+    };
+
+    struct stuRawToken{
+        int  Start;                                     /** < Offset of token in input.*/
+        int  Length;
+        bool Merged;                                    /** < Whether token is attached to previous one as in ". ." => "..".*/
+    };
+
+    struct stuToken{
+        int  Start;                                     /** < Offset of cleaned token in SentenceText.*/
+        int  Length;
+        bool Glued;                                     /** < Whether token is written right after previous one.*/
+        quint8 Quotes;                                  /** < enuQuote flags of quote characters in token.*/
+    };
+
+private:
+    int readLine(const QChar* _data, int _size, int _pos);
+    void appendToken(const QChar* _token, int _length, bool _glued);
+    void pairQuotes(enuQuote _quote);
+    void writeSentence();
+
+    static int ixmlTagLength(const QChar* _data, int _size);
+    static bool isSuffix(const QChar* _token, int _length);
+
+private:
+    bool                    Detokenize;
+    bool                    HinidiDigits;
+    bool                    ArabicPunctuations;
+    bool                    BreakSentences;
+
+    QVector<stuRawToken>    RawTokens;                  /** < Tokens of current line.*/
+    QString                 SentenceText;               /** < Cleaned tokens of current sentence.*/
+    QVector<stuToken>       Tokens;                     /** < Tokens of current sentence.*/
+    int                     SentenceRawTokens;          /** < Number of input tokens of current sentence.*/
+    quint8                  SentenceQuotes;             /** < enuQuote flags of stand-alone quotes of current sentence.*/
+    int                     LineSentences;              /** < Number of sentences written for current line.*/
+    QString                 Output;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREADER_H
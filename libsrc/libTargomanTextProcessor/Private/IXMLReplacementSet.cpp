@@ -0,0 +1,205 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QReadWriteLock>
+#include <QStringList>
+
+#include "IXMLReplacementSet.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+static QReadWriteLock                               RegistryLock;   /** < Guards Registry and LastHandle.*/
+static QHash<quint32, IXMLReplacementSet::Ptr_t>    Registry;       /** < Registered sets by their handles.*/
+static quint32                                      LastHandle = 0;
+
+/**
+ * @brief compiles replacements and merges consecutive replacements of literals when possible.
+ * @exception throws exTextProcessor if a pattern is invalid.
+ */
+IXMLReplacementSet::IXMLReplacementSet(const QList<stuIXMLReplacement> &_replacements)
+{
+    QStringList Literals;                   // literals of batch which is being merged
+    QStringList Outputs;                    // replacements of literals of batch
+    auto addLiterals = [this, &Literals, &Outputs] () {
+        if (Literals.isEmpty())
+            return;
+        stuBatch Batch;
+        QStringList Patterns;
+        for (int i = 0; i < Literals.size(); ++i){
+            Patterns.append(QRegularExpression::escape(Literals.at(i)));
+            Batch.Literals.insert(Literals.at(i), Outputs.at(i));
+        }
+        Batch.Regex = QRegularExpression(Patterns.join('|'));
+        Batch.Regex.optimize();
+        if (Literals.size() == 1){
+            Batch.After = Outputs.first();
+            Batch.Literals.clear();
+        }
+        this->Batches.append(Batch);
+        Literals.clear();
+        Outputs.clear();
+    };
+
+    foreach(const stuIXMLReplacement& Replacement, _replacements){
+        if (Replacement.SearchRegExp.isValid() == false)
+            throw exTextProcessor(QString("Invalid replacement pattern <%1>: %2").arg(
+                                      Replacement.SearchRegExp.pattern()).arg(
+                                      Replacement.SearchRegExp.errorString()));
+
+        QString Literal;
+        if (Replacement.AfterString.size() &&
+            Replacement.AfterString.contains('\\') == false &&
+            literalOf(Replacement.SearchRegExp, Literal)){
+            for (int i = 0; i < Literals.size(); ++i)
+                if (overlaps(Literal, Literals.at(i)) || overlaps(Literal, Outputs.at(i))){
+                    addLiterals();
+                    break;
+                }
+            Literals.append(Literal);
+            Outputs.append(Replacement.AfterString);
+            continue;
+        }
+
+        addLiterals();
+        stuBatch Batch;
+        Batch.Regex = Replacement.SearchRegExp;
+        Batch.Regex.optimize();
+        Batch.After = Replacement.AfterString;
+        this->Batches.append(Batch);
+    }
+    addLiterals();
+}
+
+/**
+ * @brief applies all replacements of set on ixml in their order.
+ */
+void IXMLReplacementSet::apply(QString &_ixml) const
+{
+    foreach(const stuBatch& Batch, this->Batches){
+        if (Batch.Literals.isEmpty()){
+            _ixml.replace(Batch.Regex, Batch.After);
+            continue;
+        }
+
+        QRegularExpressionMatchIterator Matches = Batch.Regex.globalMatch(_ixml);
+        if (Matches.hasNext() == false)
+            continue;
+        QString Output;
+        Output.reserve(_ixml.size());
+        int Last = 0;
+        while (Matches.hasNext()){
+            QRegularExpressionMatch Match = Matches.next();
+            Output.append(_ixml.midRef(Last, Match.capturedStart() - Last));
+            Output.append(Batch.Literals.value(Match.captured()));
+            Last = Match.capturedEnd();
+        }
+        Output.append(_ixml.midRef(Last));
+        _ixml = Output;
+    }
+}
+
+/**
+ * @brief compiles and registers a replacement set.
+ * @return handle of registered set which is never 0.
+ */
+quint32 IXMLReplacementSet::add(const QList<stuIXMLReplacement> &_replacements)
+{
+    Ptr_t Set(new IXMLReplacementSet(_replacements));
+
+    QWriteLocker Locker(&RegistryLock);
+    do
+        ++LastHandle;
+    while (LastHandle == 0 || Registry.contains(LastHandle));
+    Registry.insert(LastHandle, Set);
+    return LastHandle;
+}
+
+/**
+ * @brief unregisters a replacement set. Calls which are applying it finish with it.
+ * @return false if handle was not registered.
+ */
+bool IXMLReplacementSet::remove(quint32 _handle)
+{
+    QWriteLocker Locker(&RegistryLock);
+    return Registry.remove(_handle) > 0;
+}
+
+/**
+ * @brief returns a registered replacement set or a null pointer if handle is not registered.
+ */
+IXMLReplacementSet::Ptr_t IXMLReplacementSet::find(quint32 _handle)
+{
+    QReadLocker Locker(&RegistryLock);
+    return Registry.value(_handle);
+}
+
+/**
+ * @brief checks whether a pattern only matches a literal string and stores that string in _literal. Escaped
+ * non-alphanumeric characters are accepted as literals.
+ */
+bool IXMLReplacementSet::literalOf(const QRegularExpression &_regex, QString &_literal)
+{
+    static const QString MetaCharacters = QStringLiteral("^$.|?*+()[]{}");
+
+    if (_regex.patternOptions() != QRegularExpression::NoPatternOption)
+        return false;
+
+    QString Pattern = _regex.pattern();
+    _literal.reserve(Pattern.size());
+    for (int i = 0; i < Pattern.size(); ++i){
+        QChar Char = Pattern.at(i);
+        if (Char == '\\'){
+            if (++i == Pattern.size() || Pattern.at(i).isLetterOrNumber())
+                return false;
+            Char = Pattern.at(i);
+        }else if (MetaCharacters.contains(Char))
+            return false;
+        _literal.append(Char);
+    }
+    return _literal.size() > 0;
+}
+
+/**
+ * @brief whether an occurrence of one string can share characters with an occurrence of the other one, i.e. one of
+ * them contains the other or a suffix of one of them is a prefix of the other.
+ */
+bool IXMLReplacementSet::overlaps(const QString &_first, const QString &_second)
+{
+    if (_first.contains(_second) || _second.contains(_first))
+        return true;
+    for (int Length = 1; Length < qMin(_first.size(), _second.size()); ++Length)
+        if (_first.rightRef(Length) == _second.leftRef(Length) || _second.rightRef(Length) == _first.leftRef(Length))
+            return true;
+    return false;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREPLACEMENTSET_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREPLACEMENTSET_H
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QVector>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The IXMLReplacementSet class holds a list of ixml replacements which is compiled once and applied to many
+ * texts.
+ *
+ * Replacements are applied in their order, each on output of previous ones. Consecutive replacements of literal
+ * strings are merged to a single alternation which replaces all of them in one pass. A literal is only merged when
+ * this can not change result: it must not overlap or contain, or be contained in, a literal of the batch or a text
+ * which a previous replacement of the batch writes, and its replacement must not be empty.
+ *
+ * Sets are kept in a registry and are identified by handles. A set which is being applied remains valid until it is
+ * released even if it is unregistered meanwhile.
+ */
+class IXMLReplacementSet
+{
+public:
+    typedef QSharedPointer<const IXMLReplacementSet> Ptr_t;
+
+    explicit IXMLReplacementSet(const QList<stuIXMLReplacement>& _replacements);
+    void apply(INOUT QString& _ixml) const;
+
+    static quint32 add(const QList<stuIXMLReplacement>& _replacements);
+    static bool remove(quint32 _handle);
+    static Ptr_t find(quint32 _handle);
+
+private:
+    struct stuBatch{
+        QRegularExpression      Regex;
+        QString                 After;                  /** < Replacement of a batch with a single rule.*/
+        QHash<QString, QString> Literals;               /** < Replacement of each literal of a merged batch.*/
+    };
+
+private:
+    static bool literalOf(const QRegularExpression& _regex, QString& _literal);
+    static bool overlaps(const QString& _first, const QString& _second);
+
+private:
+    QVector<stuBatch>           Batches;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_IXMLREPLACEMENTSET_H
@@ -35,25 +35,25 @@ namespace Private {
 
 #define TGMN_SUFFIXES "t|ll|ve|s|m|re|d" //these terms can come after apostrofe
 
-IXMLWriter::IXMLWriter() :
-    NormalizerInstance(Normalizer::instance()),
-    SpellCorrectorInstance(SpellCorrector::instance())
+IXMLWriter::IXMLWriter(Normalizer& _normalizer, SpellCorrector& _spellCorrector) :
+    StageIDs{-1, -1, -1, -1, -1, -1, -1},
+    NormalizerInstance(_normalizer),
+    SpellCorrectorInstance(_spellCorrector)
 {}
 
 /**
- * @brief Reads abbriviation from file and adds them to #RxAbbrDic
+ * @brief Reads abbriviation from file and builds #Abbreviations matcher and entity detection stages.
  * @param _configFile abbriviation file address.
  */
 
 void IXMLWriter::init(const QString &_configFile)
 {
-    this->AbbreviationDetectionRegexPattern = QStringLiteral("");
+    QStringList AbbreviationEntries;
 
     QFile AbbrF(_configFile);
     AbbrF.open(QIODevice::ReadOnly);
     QByteArray DataLine;
     int CommentIndex = -1;
-    int line = 0;
     while (!AbbrF.atEnd())
     {
         DataLine = AbbrF.readLine().trimmed();
@@ -61,110 +61,225 @@ void IXMLWriter::init(const QString &_configFile)
             continue;
         if ((CommentIndex = DataLine.indexOf("##")) >= 0)
             DataLine.truncate(CommentIndex);
-        if (line > 0) {
-            this->AbbreviationDetectionRegexPattern.append("|");
-        } else {
-            this->AbbreviationDetectionRegexPattern.append("\\b(");
-        }
-        line++;
-        this->AbbreviationDetectionRegexPattern.append(DataLine);
+        AbbreviationEntries.append(QString::fromUtf8(DataLine));
     }
 
-    //this->RxAbbrDic = QRegularExpression (AbbreviationDetectionRegex + ")(?=\\b)");
+    this->Abbreviations.init(AbbreviationEntries);
+    this->compileTaggingStages();
 }
 
 /**
- * @brief finds and tags some patterns in input text and converts them to  ixml format.
- * @param _inStr  input string
- * @param _lang language for input argument of SpellCorrector class.
- * @param _lineNo line number
- * @param _interactive argument of spellCorrector and normalizer. can SpellCorrector or Normalizer class be done interactively or not.
- * @param _useSpellCorrector use spell corrector or not.
- * @param _putXmlTagsInSeperateList put xml tages in _lstXmlTags or put them in text
- * @param _lstXmlTags list of Xml tags
- * @return returns converted ixml text.
+ * @brief returns tag of an entity kind which is rendered as a tag.
  */
-
-QString IXMLWriter::convert2IXML(const QString &_inStr,
-                                 bool &_spellCorrected,
-                                 bool _putXmlTagsInSeperateList,
-                                 QVariantList* _lstXmlTags,
-                                 const QList<enuTextTags::Type> _removingTags,
-                                 const QString& _lang,
-                                 quint32 _lineNo,
-                                 bool _interactive,
-                                 bool _useSpellCorrector,
-                                 bool _setTagValue,
-                                 bool _convertToLower,
-                                 bool _detectSymbols,
-                                 bool _setTagIndex)
+static inline enuTextTags::Type tagTypeOf(stuTaggedEntities::enuKind _kind)
 {
-    // Email detection
-    thread_local static QRegularExpression RxEmail = QRegularExpression("([A-Za-z0-9._%+-][A-Za-z0-9._%+-]*@[A-Za-z0-9.-][A-Za-z0-9.-]*\\.[A-Za-z]{2,4})");
-    thread_local static QRegularExpression RxAbbrDic;
-    
-    bool RxAbbrDicIsValid = false;
-    if(this->AbbreviationDetectionRegexPattern.length() > 0) {
-        RxAbbrDic.setPattern(this->AbbreviationDetectionRegexPattern + ")(?=[^\\w]|$)");
-        RxAbbrDicIsValid = true;
+    switch (_kind){
+    case stuTaggedEntities::Email:          return enuTextTags::Email;
+    case stuTaggedEntities::URL:            return enuTextTags::URL;
+    case stuTaggedEntities::Abbreviation:   return enuTextTags::Abbreviation;
+    case stuTaggedEntities::Date:           return enuTextTags::Date;
+    case stuTaggedEntities::Time:           return enuTextTags::Time;
+    case stuTaggedEntities::SpecialNumber:  return enuTextTags::SpecialNumber;
+    case stuTaggedEntities::OrderedItem:    return enuTextTags::OrderedListItem;
+    case stuTaggedEntities::Symbol:         return enuTextTags::Symbol;
+    case stuTaggedEntities::Ordinal:        // Ordinals are rendered without tag, so there is no tag to remove
+    case stuTaggedEntities::MultiDot:
+    case stuTaggedEntities::Suffix:         return enuTextTags::Unknown;
+    default:                                return enuTextTags::Number;
     }
+}
 
-    QStringList AllowedFarsiDomainNames = {
-        QStringLiteral("کام"),
-        QStringLiteral("نت"),
-        QStringLiteral("ارگ"),
-        QStringLiteral("آی‌آر")
-    };
-
-    static QString URLRegExPattern= QStringLiteral("(?:(?:https?|ftp)://)?"
-                                                   "(?:(?!10(?:\\.\\d{1,3}){3})"
-                                                   //      "(?!127(?:\\.\\d{1,3}){3})"
-                                                   //      "(?!169\\.254(?:\\.\\d{1,3}){2})"
-                                                   //      "(?!192\\.168(?:\\.\\d{1,3}){2})"
-                                                   //      "(?!172\\.(?:1[6-9]|2\\d|3[0-1])(?:\\.\\d{1,3}){2})"
-                                                   "(?:[1-9]\\d?|1\\d\\d|2[01]\\d|22[0-3])"
-                                                   "(?:\\.(?:1?\\d{1,2}|2[0-4]\\d|25[0-5])){2}"
-                                                   "(?:\\.(?:[1-9]\\d?|1\\d\\d|2[0-4]\\d|25[0-4]))"
-                                                   "|(?:(?:[a-z\u00a1-\uffff0-9]+-?)*[a-z\u00a1-\uffff0-9]+)"
-                                                   "(?:\\.(?:[a-z\u00a1-\uffff0-9]+-?)*[a-z\u00a1-\uffff0-9]+)*"
-                                                   "(?:\\.(?:[a-z]{2,4}|") +
-                                                   AllowedFarsiDomainNames.join("|") +
-                                                   QStringLiteral(")))(?::\\d{2,5})?(?:/[^\\s]*)?");
-
-    thread_local static QRegularExpression RxURL = QRegularExpression(URLRegExPattern, QRegularExpression::CaseInsensitiveOption);
-
-    thread_local static QRegularExpression RxURLValidator = QRegularExpression("^" + URLRegExPattern + "$",  QRegularExpression::CaseInsensitiveOption);
-
+/**
+ * @brief Compiles entity detection stages in their priority order. Each stage is applied on output of previous ones.
+ * All stages of pipeline are registered in PipelineStats in their order.
+ */
+void IXMLWriter::compileTaggingStages()
+{
+    // Numbers
+    static QString NumberPattern = QStringLiteral("[\\+\\-]?[0-9]{1,3}[',](?:[0-9]{3}[',])*[0-9]{3}(?:\\.[0-9][0-9]*)?|"
+                                                  "[\\+\\-]?[0-9][0-9]*(?:\\.[0-9][0-9]*)?");
+    static QString NumberRightPattern = QStringLiteral("(?:[\\+\\-])?[0-9]{1,3}[',](?:[0-9]{3}[',])*[0-9]{3}(?:\\.[0-9][0-9]*)?|"
+                                                       "(?:[\\+\\-])?[0-9][0-9]*(?:\\.[0-9][0-9]*)?");
+
+    PipelineStats& Stats = PipelineStats::instance();
+    this->StageIDs.Normalize = Stats.registerStage("NRM");
+    this->StageIDs.Numbering = Stats.registerStage("OLI");
+    this->StageIDs.PersianNumber = Stats.registerStage("P2N");
+    this->StageIDs.ScriptSplit = Stats.registerStage("P2L");
+
+    this->Tagger.clear();
+    // Email detection
+    this->Tagger.addMarkingStage(&this->Emails, stuTaggedEntities::Email, "EML",
+                                 stuCharClasses::At | stuCharClasses::Dot | stuCharClasses::Latin);
     // Abbreviations
-    // thread_local static QRegularExpression RxAbbr = QRegularExpression(QStringLiteral("\\b([A-Z]\\.(?:[A-Z\\d]\\.)(?:[A-Z\\d]\\.)*)(?=[^\\w]|$)"));
-    // thread_local static QRegularExpression RxAbbrDotless = QRegularExpression(QStringLiteral("\\b([A-Z]\\.[A-Z\\d](?:\\.[A-Z\\d])*)\\b"));
-    thread_local static QRegularExpression RxMultiDots = QRegularExpression(QStringLiteral("(\\.\\.(\\.)*)"));
-
-    // suffixes
-    thread_local static QRegularExpression RxSuffix = QRegularExpression(QStringLiteral("((?:'(?:%1))\\b)").arg(TGMN_SUFFIXES));
-
+    // RxAbbr = QRegularExpression(QStringLiteral("\\b([A-Z]\\.(?:[A-Z\\d]\\.)(?:[A-Z\\d]\\.)*)(?=[^\\w]|$)"));
+    // RxAbbrDotless = QRegularExpression(QStringLiteral("\\b([A-Z]\\.[A-Z\\d](?:\\.[A-Z\\d])*)\\b"));
+    if (this->Abbreviations.isEmpty() == false)
+        this->Tagger.addMarkingStage(&this->Abbreviations, stuTaggedEntities::Abbreviation, "ABD",
+                                     this->Abbreviations.requiredClasses());
+    this->Tagger.addMarkingStage(&this->URLs, stuTaggedEntities::URL, "URL", stuCharClasses::Dot);
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("(\\.\\.(\\.)*)")),
+                                 stuTaggedEntities::MultiDot, "MDT", 0, stuCharClasses::Dot);
     //TODO: complete these regexes
     // Dates
-    thread_local static QRegularExpression RxDate = QRegularExpression(QStringLiteral("(?:\\b(?:[0-9]{1,4}[/\\\\-][0-9]{1,2}[/\\\\-][0-9]{1,4})\\b)"));
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("(?:\\b(?:[0-9]{1,4}[/\\\\-][0-9]{1,2}[/\\\\-][0-9]{1,4})\\b)")),
+                                 stuTaggedEntities::Date, "DAT", 0, stuCharClasses::Digit);
     // Times
-    thread_local static QRegularExpression RxTime = QRegularExpression(QStringLiteral("(?:\\b(?:[0-9]{1,2}:[0-9]{1,2}(?::[0-9]{1,2})?)\\b)"));
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("(?:\\b(?:[0-9]{1,2}:[0-9]{1,2}(?::[0-9]{1,2})?)\\b)")),
+                                 stuTaggedEntities::Time, "TIM", 0, stuCharClasses::Digit | stuCharClasses::Colon);
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("((?:\\b)(?:1st|2nd|3rd|\\d+th)(?:\\b))")),
+                                 stuTaggedEntities::Ordinal, "ORD", 0, stuCharClasses::Digit | stuCharClasses::Latin);
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("(\\d+\\.\\d+\\.(?:\\d+\\.?)*|^\\d+\\.)")),
+                                 stuTaggedEntities::SpecialNumber, "SNM", 0, stuCharClasses::Digit | stuCharClasses::Dot);
+    // adds space before and after dashes and underlines in string.
+    this->Tagger.addRewritingStage(QRegularExpression(QStringLiteral("(\\w)\\-(\\w)")), "\\1 - \\2", "DSH", stuCharClasses::Dash);
+    this->Tagger.addRewritingStage(QRegularExpression(QStringLiteral("(\\w)\\_(\\w)")), "\\1 _ \\2", "UND", stuCharClasses::Underscore);
+    //((?:(?:(?:\\b)(:num:))|(?:(?::num:)(?:\\b)))(?=([^\\.\\d]|\\.(?:[^\\d]|$))))
+    this->Tagger.addMarkingStage(QRegularExpression("(?:([^a-zA-Z0-9])(" + NumberRightPattern +
+                                                    ")(?:\\b))(?=([^\\.\\d]|\\.(?:[^\\d]|$)))"),
+                                 stuTaggedEntities::NumberRight, "NUR", 2, stuCharClasses::Digit);
+    this->Tagger.addMarkingStage(QRegularExpression("((?:(?:\\b)(" + NumberPattern +
+                                                    "))(?=([^\\.\\d]|\\.(?:[^\\d]|$))))"),
+                                 stuTaggedEntities::NumberLeft, "NUL", 0, stuCharClasses::Digit);
+    // suffixes
+    this->Tagger.addMarkingStage(QRegularExpression(QStringLiteral("((?:'(?:%1))\\b)").arg(TGMN_SUFFIXES)),
+                                 stuTaggedEntities::Suffix, "SFX", 0, stuCharClasses::Apostrophe | stuCharClasses::Latin);
 
-    // Numbers
-    thread_local static QRegularExpression RxDashSeparator = QRegularExpression(QStringLiteral("(\\w)\\-(\\w)"));
-    thread_local static QRegularExpression RxUnderlineSeparator = QRegularExpression(QStringLiteral("(\\w)\\_(\\w)"));
-    thread_local static QRegularExpression RxSpecialNumber = QRegularExpression(QStringLiteral("(\\d+\\.\\d+\\.(?:\\d+\\.?)*|^\\d+\\.)"));
+    this->StageIDs.Tokenize = Stats.registerStage("TKN");
+    this->StageIDs.SpellCorrect = Stats.registerStage("SPL");
+    this->StageIDs.Render = Stats.registerStage("RND");
+}
 
-    //((?:(?:(?:\\b)(:num:))|(?:(?::num:)(?:\\b)))(?=([^\\.\\d]|\\.(?:[^\\d]|$))))
-    thread_local static QRegularExpression RxNumberLeft = QRegularExpression("((?:(?:\\b)(" +
-                                 QStringLiteral("[\\+\\-]?[0-9]{1,3}[',](?:[0-9]{3}[',])*[0-9]{3}(?:\\.[0-9][0-9]*)?|"
-                                                   "[\\+\\-]?[0-9][0-9]*(?:\\.[0-9][0-9]*)?") +
-                                 "))(?=([^\\.\\d]|\\.(?:[^\\d]|$))))");
+#define CHAR_CLASS_WORD        0x00
+#define CHAR_CLASS_SEPARATOR   0x01 //Characters which are tokens by themselves
+#define CHAR_CLASS_SYMBOL      0x02 //Modifier, math and other symbols which are kept in words
+
+/**
+ * @brief returns class of each UTF-16 code unit. Classes are computed once from unicode categories.
+ */
+static const quint8* charClasses()
+{
+    static quint8 Classes[0x10000];
+    static bool Initialized = [](){
+        for (uint i = 0; i < 0x10000; ++i){
+            QChar Char(static_cast<ushort>(i));
+            if (Char.category() == QChar::Symbol_Modifier ||
+                Char.category() == QChar::Symbol_Math ||
+                Char.category() == QChar::Symbol_Other)
+                Classes[i] = CHAR_CLASS_SYMBOL;
+            else if (Char.isLetterOrNumber() == false && Char != ARABIC_ZWNJ)
+                Classes[i] = CHAR_CLASS_SEPARATOR;
+            else
+                Classes[i] = CHAR_CLASS_WORD;
+        }
+        return true;
+    }();
+    Q_UNUSED(Initialized)
+    return Classes;
+}
+
+/**
+ * @brief adds space before and after separator characters. When _detectSymbols is set, tokens which consist of
+ * symbols only are stored as symbol entities and replaced by their placeholder, and tokens are joined by single
+ * spaces. Both are done in a single pass.
+ * @param _output will be set to tokenized phrase.
+ * @param _map if provided, it must map _phrase and will be updated to map _output.
+ */
+static void tokenize(const QString& _phrase,
+                     QString& _output,
+                     stuTaggedEntities& _entities,
+                     bool _detectSymbols,
+                     SourceMap* _map)
+{
+    const quint8* Classes = charClasses();
+    const QChar* Data = _phrase.constData();
+    int Size = _phrase.size();
+    SourceMap Map;
+
+    _output.clear();
+    _output.reserve(Size * 2 + 8);
+    if (_map)
+        Map.reserve(Size * 2 + 8);
+
+    if (_detectSymbols == false){
+        for (int i = 0; i < Size; ++i){
+            if (Classes[Data[i].unicode()] == CHAR_CLASS_SEPARATOR){
+                _output.append(' ').append(Data[i]).append(' ');
+                if (_map){
+                    Map.append(stuSourceSpan());
+                    Map.append(_map->at(i));
+                    Map.append(stuSourceSpan());
+                }
+            }else{
+                _output.append(Data[i]);
+                if (_map)
+                    Map.append(_map->at(i));
+            }
+        }
+        if (_map)
+            qSwap(*_map, Map);
+        return;
+    }
 
-    thread_local static QRegularExpression RxNumberRight = QRegularExpression("(?:([^a-zA-Z0-9])(" +
-                                  QStringLiteral("(?:[\\+\\-])?[0-9]{1,3}[',](?:[0-9]{3}[',])*[0-9]{3}(?:\\.[0-9][0-9]*)?|"
-                                                    "(?:[\\+\\-])?[0-9][0-9]*(?:\\.[0-9][0-9]*)?") +
-                                  +")(?:\\b))(?=([^\\.\\d]|\\.(?:[^\\d]|$)))");
+    const QChar Placeholder = stuTaggedEntities::placeholder(stuTaggedEntities::Symbol);
+    int i = 0;
+    while (i < Size){
+        int Start = i;
+        bool IsSymbol = false;
+        if (Classes[Data[i].unicode()] == CHAR_CLASS_SEPARATOR){
+            if (Data[i++] == ' ')
+                continue;
+        }else{
+            IsSymbol = true;
+            for (; i < Size && Classes[Data[i].unicode()] != CHAR_CLASS_SEPARATOR; ++i)
+                IsSymbol &= Classes[Data[i].unicode()] == CHAR_CLASS_SYMBOL;
+        }
+
+        if (_output.size()){
+            _output.append(' ');
+            if (_map)
+                Map.append(stuSourceSpan());
+        }
+        if (IsSymbol){
+            _entities.append(stuTaggedEntities::Symbol, Data + Start, i - Start);
+            _output.append(' ').append(Placeholder).append(' ');
+            if (_map){
+                Map.append(stuSourceSpan());
+                Map.append(_map->span(Start, i - Start));
+                Map.append(stuSourceSpan());
+            }
+        }else{
+            _output.append(Data + Start, i - Start);
+            if (_map)
+                Map.appendCopy(*_map, Start, i - Start);
+        }
+    }
+    if (_map)
+        qSwap(*_map, Map);
+}
 
+/**
+ * @brief normalizes input text, finds entities and replaces them by their placeholders, tokenizes and spell corrects
+ * it. This is common part of all output formats.
+ * @param _entities values of found entities in order of their appearance.
+ * @param _skippedKinds combination of stuTaggedEntities::kindMask() of entities which must not be detected.
+ * @param _map if provided, it will be filled with source span of each character of processed phrase.
+ * @param _spellAlignment if provided and spell corrector has changed phrase, it will be filled with alignment of tokens
+ * of processed phrase to tokens before spell correction.
+ * @return returns processed phrase ending with a dot token or an empty string for empty inputs.
+ */
+QString IXMLWriter::prepare(const QString &_inStr,
+                            stuTaggedEntities &_entities,
+                            bool &_spellCorrected,
+                            const QString &_lang,
+                            quint32 _lineNo,
+                            bool _interactive,
+                            bool _useSpellCorrector,
+                            bool _detectSymbols,
+                            quint32 _skippedKinds,
+                            SourceMap *_map,
+                            QVector<stuTokenRange> *_spellAlignment)
+{
     thread_local static QRegularExpression RxNumberValidator =
             QRegularExpression("^[\\+\\-]?[0-9]{1,3}[',](?:[0-9]{3}[',])*[0-9]{3}(?:\\.[0-9][0-9]*)?|"
                     "[\\+\\-]?[0-9][0-9]*(?:\\.[0-9][0-9]*)?$");
@@ -182,7 +297,6 @@ QString IXMLWriter::convert2IXML(const QString &_inStr,
                                                   "(?:[\\-\\.\\s\\)>])"
                                                   ")"));
 
-    thread_local static QRegularExpression RxOrdinalNumber = QRegularExpression(QStringLiteral("((?:\\b)(?:1st|2nd|3rd|\\d+th)(?:\\b))"));
     thread_local static QRegularExpression RxPersianLatin = QRegularExpression(QStringLiteral("([\u0600-\u06ff])(\\d+)?([a-zA-Z])"));
     thread_local static QRegularExpression RxLatinPersian = QRegularExpression(QStringLiteral("([a-zA-Z])(\\d+)?([\u0600-\u06ff])"));
     thread_local static QRegularExpression RxPersianNumber = QRegularExpression(QStringLiteral("([\u0600-\u06ff])(\\d+)"));
@@ -196,313 +310,437 @@ QString IXMLWriter::convert2IXML(const QString &_inStr,
     TargomanDebug(6,"[ORG] "<<InputPhrase);
 
     //Normalize
+    StageTimer Timer(this->StageIDs.Normalize);
     OutputPhrase.clear();
     OutputPhrase.append(" "); // prepend a space before string.
+    if (_map){
+        _map->clear();
+        _map->reserve(InputPhrase.size() + 3);
+        _map->append(stuSourceSpan());
+    }
 
     //normalize input text.
-    for (int i=0; i<InputPhrase.size(); i++){
-        OutputPhrase.append(this->NormalizerInstance.normalize(
-                    InputPhrase.at(i),
-                    ((i + 1) < InputPhrase.size() ? InputPhrase.at(i+1) : QChar('\n')),
-                    _interactive,
-                    _lineNo,
-                    InputPhrase,
-                    static_cast<size_t>(i)));
-    }
+    stuNormalizationContext NormalizationContext;
+    OutputPhrase.reserve(InputPhrase.size() + 3);
+    this->NormalizerInstance.normalize(InputPhrase.constData(),
+                                       InputPhrase.size(),
+                                       NormalizationContext,
+                                       OutputPhrase,
+                                       _interactive,
+                                       static_cast<qint32>(_lineNo),
+                                       _map);
+    // Classes are collected before appending the final dot, as no stage can match a dot which follows a space
+    quint16 CharClasses = stuCharClasses::of(OutputPhrase.constData(), OutputPhrase.size());
     OutputPhrase+=" ."; //append a space and a dot to the end of string for some bug fixings.
-
-    QStringList LstURL;             //list of found URLs
-    QStringList LstEmail;           //list of found Emails
-    QStringList LstAbbr[3];         //list of found three kind of abbriviations.
-    QStringList LstDate;            //list of found Dates.
-    QStringList LstTime;            //list of found Times.
-    QStringList LstSpecialNumber;   //list of found Special Numbers.
-    QStringList LstOrdinal;         //list of found Ordinal Numbers.
-    QStringList LstNumberLeft;      //list of found Numbers that were in left side of a word.
-    QStringList LstNumberRight;     //list of found Numbers that were in right side of a word.
-    QStringList LstSuffixes;        //list of found Suffixes.
-    QStringList LstOrderedItem;     //list of found ordered items.
-    QStringList LstSymbols;         //list of found symbols.
+    if (_map)
+        _map->append(stuSourceSpan(), 2);
 
     TargomanDebug(7,"[NRM] |"<<OutputPhrase<<"|");
-    OutputPhrase.replace("&amp;", " & ").replace("&gt;", " > ").replace("&lt;", " < "); //replace '<' a '>' with some special string in order to prevent errors in xml tags.
+    //replace '<' a '>' with some special string in order to prevent errors in xml tags.
+    SourceMap::replace(OutputPhrase, "&amp;", " & ", _map);
+    SourceMap::replace(OutputPhrase, "&gt;", " > ", _map);
+    SourceMap::replace(OutputPhrase, "&lt;", " < ", _map);
     TargomanDebug(7,"[NR2] |"<<OutputPhrase<<"|");
-    OutputPhrase.replace(RxNumbering, "\\1 ");
+    Timer.finish();
+
+    Timer = StageTimer(this->StageIDs.Numbering);
+    int SizeBefore = OutputPhrase.size();
+    SourceMap::replace(OutputPhrase, RxNumbering, "\\1 ", _map);
     TargomanDebug(7,"[OLI] |"<<OutputPhrase<<"|");
     QStringList PhraseTokens = OutputPhrase.split(" ", QString::SkipEmptyParts);
 
     // if first token is number we are not sure whether it is for ordered list or not. So we will check it in this if
+    bool FirstTokenTagged = false;
     if (PhraseTokens.size() && RxNumbering.match(PhraseTokens.first()).hasMatch()){
-        if (RxNumberValidator.match(PhraseTokens.first()).hasMatch()){ //check whether first token is a normal number (numbers with optional thousand seperator or decimal numbers )or not.
-            LstNumberLeft.append(PhraseTokens.first());
-            PhraseTokens[0] = "TGMNNUL";
-        }else if (RxURLValidator.match(PhraseTokens.first()).hasMatch()){ //check whether first token is IP of a website or not.
-            LstURL.append(PhraseTokens.first());
-            PhraseTokens[0] = "TGMNURL";
-        }else if (RxAbbrDicIsValid && RxAbbrDic.match(PhraseTokens.first()).hasMatch()){ //check whether first token is in abbreviation dictionary or not.
-            LstAbbr[0].append(PhraseTokens.first());
-            PhraseTokens[0] = "TGMNABD";
-        }else{  // if first token was non of the above, it is ordered list item.
-            LstOrderedItem.append(PhraseTokens.first());
-            PhraseTokens[0] = "TGMNOLI";
+        stuTaggedEntities::enuKind Kind;
+        if (RxNumberValidator.match(PhraseTokens.first()).hasMatch()) //check whether first token is a normal number (numbers with optional thousand seperator or decimal numbers )or not.
+            Kind = stuTaggedEntities::NumberLeft;
+        else if (this->URLs.isURL(PhraseTokens.first())) //check whether first token is IP of a website or not.
+            Kind = stuTaggedEntities::URL;
+        else if (this->Abbreviations.hasMatch(PhraseTokens.first())) //check whether first token is in abbreviation dictionary or not.
+            Kind = stuTaggedEntities::Abbreviation;
+        else  // if first token was non of the above, it is ordered list item.
+            Kind = stuTaggedEntities::OrderedItem;
+        // first token is left as is when detection of its kind is skipped.
+        if ((_skippedKinds & stuTaggedEntities::kindMask(Kind)) == 0){
+            _entities.append(Kind, PhraseTokens.first());
+            PhraseTokens[0] = stuTaggedEntities::placeholder(Kind);
+            SourceMap::joinTokens(OutputPhrase, PhraseTokens, _map);
+            FirstTokenTagged = true;
         }
-        OutputPhrase = PhraseTokens.join(" ");
     }
+    Timer.finish(FirstTokenTagged || OutputPhrase.size() != SizeBefore);
+
     //adds a space between persian word and number
-    OutputPhrase.replace(RxPersianNumber, "\\1 \\2");
+    if (stuCharClasses::hasAll(CharClasses, stuCharClasses::Arabic | stuCharClasses::Digit)){
+        Timer = StageTimer(this->StageIDs.PersianNumber);
+        SizeBefore = OutputPhrase.size();
+        SourceMap::replace(OutputPhrase, RxPersianNumber, "\\1 \\2", _map);
+        Timer.finish(OutputPhrase.size() != SizeBefore);
+    }else
+        PipelineStats::instance().recordSkip(this->StageIDs.PersianNumber);
     TargomanDebug(7,"[P2N] |"<<OutputPhrase<<"|");
-    //adds spaces between persian word ,number and latin word.
-    OutputPhrase.replace(RxPersianLatin, "\\1 \\2 \\3");
-    TargomanDebug(7,"[P2L] |"<<OutputPhrase<<"|");
-    // it doesn't add space between latin word and number but adds space between number and persian word.
-    OutputPhrase.replace(RxLatinPersian, "\\1\\2  \\3");
-    TargomanDebug(7,"[L2P] |"<<OutputPhrase<<"|");
-
-    //find and replace a list patterns.
-    OutputPhrase = this->markByRegex(OutputPhrase, RxEmail, "EML", &LstEmail);
-    // OutputPhrase = this->markByRegex(OutputPhrase, RxAbbr, "ABR", &LstAbbr[1]);
-    // OutputPhrase = this->markByRegex(OutputPhrase, RxAbbrDotless, "ABS", &LstAbbr[2]);
-    if(RxAbbrDicIsValid) {
-        OutputPhrase = this->markByRegex(OutputPhrase, RxAbbrDic, "ABD", &LstAbbr[0]);
-    }
-    OutputPhrase = this->markByRegex(OutputPhrase, RxURL, "URL", &LstURL);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxMultiDots, "MDT", nullptr);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxDate, "DAT", &LstDate);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxTime, "TIM", &LstTime);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxOrdinalNumber, "ORD", &LstOrdinal);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxSpecialNumber, "SNM", &LstSpecialNumber);
-    OutputPhrase.replace(RxDashSeparator, "\\1 - \\2"); // adds space before and after dashes in string.
-    TargomanDebug(7,"[DSH] |"<<OutputPhrase<<"|");
-    OutputPhrase.replace(RxUnderlineSeparator, "\\1 _ \\2"); // adds space before and after underlines in string.
-    TargomanDebug(7,"[UND] |"<<OutputPhrase<<"|");
-    OutputPhrase = this->markByRegex(OutputPhrase, RxNumberRight,"NUR", &LstNumberRight, 2);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxNumberLeft, "NUL", &LstNumberLeft);
-    OutputPhrase = this->markByRegex(OutputPhrase, RxSuffix, "SFX", &LstSuffixes);
-
-    //add space before and after non alphaNumeric characters.
+    if (stuCharClasses::hasAll(CharClasses, stuCharClasses::Arabic | stuCharClasses::Latin)){
+        Timer = StageTimer(this->StageIDs.ScriptSplit);
+        SizeBefore = OutputPhrase.size();
+        //adds spaces between persian word ,number and latin word.
+        SourceMap::replace(OutputPhrase, RxPersianLatin, "\\1 \\2 \\3", _map);
+        TargomanDebug(7,"[P2L] |"<<OutputPhrase<<"|");
+        // it doesn't add space between latin word and number but adds space between number and persian word.
+        SourceMap::replace(OutputPhrase, RxLatinPersian, "\\1\\2  \\3", _map);
+        TargomanDebug(7,"[L2P] |"<<OutputPhrase<<"|");
+        Timer.finish(OutputPhrase.size() != SizeBefore);
+    }else
+        PipelineStats::instance().recordSkip(this->StageIDs.ScriptSplit);
+
+    //find and replace entities by their markers. Stages which need absent classes of characters or whose kind of
+    //entities are not needed are skipped.
+    this->Tagger.tag(OutputPhrase, _entities, _map, CharClasses, _skippedKinds);
+
+    //add space before and after non alphaNumeric characters and replace symbols with their placeholder.
+    Timer = StageTimer(this->StageIDs.Tokenize);
+    int EntityCount = _entities.Spans.size();
     InputPhrase = OutputPhrase;
-    OutputPhrase.clear();
-    foreach (const QChar& Char, InputPhrase){
-        if (!Char.isLetterOrNumber() 
-                && Char != ARABIC_ZWNJ
-                && Char.category() != QChar::Symbol_Modifier 
-                && Char.category() != QChar::Symbol_Math 
-                && Char.category() != QChar::Symbol_Other){
-            OutputPhrase.append(' ');
-            OutputPhrase.append(Char);
-            OutputPhrase.append(' ');
-        }
-        else
-            OutputPhrase.append(Char);
-    }
+    tokenize(InputPhrase,
+             OutputPhrase,
+             _entities,
+             _detectSymbols && (_skippedKinds & stuTaggedEntities::kindMask(stuTaggedEntities::Symbol)) == 0,
+             _map);
+    Timer.finish(static_cast<quint64>(_entities.Spans.size() - EntityCount));
 
     TargomanDebug(7,"[TKN] |"<<OutputPhrase<<"|");
 
-    if (_detectSymbols) {
-        //for each token, if any letter of a token is a symbol, add that token to list of symbols and replace whole symbol with " TGMNSYM "
-        QStringList Tokens = OutputPhrase.split(" ",QString::SkipEmptyParts);
-        for (int i=0; i<Tokens.size(); i++) {
-            bool IsSymbol = true;
-            foreach (const QChar& Ch, Tokens[i])
-                if (Ch.category() != QChar::Symbol_Modifier &&
-                        Ch.category() != QChar::Symbol_Math &&
-                        Ch.category() != QChar::Symbol_Other){
-                    IsSymbol = false;
-                    break;
-                }
-            if (IsSymbol){
-                LstSymbols.append(Tokens[i]);
-                Tokens[i] = " TGMNSYM ";
-            }
-        }
-        OutputPhrase = Tokens.join(" ");
-    }
-
-    TargomanDebug(7,"[SYM] |"<<OutputPhrase<<"|");
-
-    if (_useSpellCorrector)
+    if (_useSpellCorrector){
+        Timer = StageTimer(this->StageIDs.SpellCorrect);
+        QString Uncorrected = OutputPhrase;
         OutputPhrase = this->SpellCorrectorInstance.process(
                     _lang,
                     OutputPhrase,
                     _spellCorrected,
                     _interactive);
+        bool Changed = OutputPhrase != Uncorrected;
+        if ((_map || _spellAlignment) && Changed){
+            QVector<stuTokenRange> Alignment = SourceMap::alignTokens(Uncorrected.split(" ", QString::SkipEmptyParts),
+                                                                      OutputPhrase.split(" ", QString::SkipEmptyParts));
+            if (_map)
+                _map->realignTokens(Uncorrected, OutputPhrase, Alignment);
+            if (_spellAlignment)
+                *_spellAlignment = Alignment;
+        }
+        Timer.finish(Changed);
+    }else
+        PipelineStats::instance().recordSkip(this->StageIDs.SpellCorrect);
 
     TargomanDebug(7,"[SPL] |"<<OutputPhrase<<"|");
 
+    return OutputPhrase;
+}
 
-    //replace targoman marks with their corresponding words, wrapped with xml tags.
-    InputPhrase = OutputPhrase;
-    OutputPhrase.clear();
+/**
+ * @brief resolves a placeholder token to value of its entity.
+ * @param _tagType set to tag of entity or enuTextTags::Unknown if entity is not rendered as a tag.
+ * @return false if token is not a placeholder.
+ */
+bool IXMLWriter::resolveEntity(const QChar *_token,
+                               int _length,
+                               const stuTaggedEntities &_entities,
+                               stuTaggedEntities::stuCursors &_cursors,
+                               enuTextTags::Type &_tagType,
+                               QString &_value)
+{
+    if (_length != 1 || stuTaggedEntities::isPlaceholder(*_token) == false)
+        return false;
+
+    stuTaggedEntities::enuKind Kind = static_cast<stuTaggedEntities::enuKind>(_token->unicode() - ENTITY_PLACEHOLDER_BASE);
+    switch (Kind){
+    case stuTaggedEntities::MultiDot:
+        _tagType = enuTextTags::Unknown;
+        _value = MULTI_DOT;
+        break;
+    case stuTaggedEntities::Ordinal:
+    case stuTaggedEntities::Suffix:
+        _tagType = enuTextTags::Unknown;
+        _value = _entities.takeNext(Kind, _cursors);
+        break;
+    default:
+        _tagType = tagTypeOf(Kind);
+        _value = _entities.takeNext(Kind, _cursors);
+    }
+    return true;
+}
+
+/**
+ * @brief returns position of each character of rendered ixml in final ixml or -1 for removed characters. Final
+ * trimming of convert2IXML() only removes characters so this mirrors its steps on positions.
+ */
+static QVector<int> finalPositions(const QString& _rendered)
+{
+    QVector<int> Kept;
+    Kept.reserve(_rendered.size());
+    for (int i = 0; i < _rendered.size() - 2; ++i)
+        Kept.append(i);
+
+    // Same as replacing double spaces twice
+    for (int Pass = 0; Pass < 2; ++Pass){
+        int Count = 0;
+        for (int k = 0; k < Kept.size(); ++k){
+            Kept[Count++] = Kept.at(k);
+            if (_rendered.at(Kept.at(k)) == ' ' && k + 1 < Kept.size() && _rendered.at(Kept.at(k + 1)) == ' ')
+                ++k;
+        }
+        Kept.resize(Count);
+    }
 
-    if(_putXmlTagsInSeperateList)
-        _lstXmlTags->clear();
+    int First = 0, Last = Kept.size();
+    while (First < Last && _rendered.at(Kept.at(First)).isSpace())
+        ++First;
+    while (Last > First && _rendered.at(Kept.at(Last - 1)).isSpace())
+        --Last;
+
+    QString Trimmed;
+    Trimmed.reserve(Last - First);
+    for (int k = First; k < Last; ++k)
+        Trimmed.append(_rendered.at(Kept.at(k)));
+
+    QVector<int> Positions(_rendered.size(), -1);
+    int Position = 0;
+    for (int k = 0; k < Trimmed.size(); ++k)
+        if (Normalizer::isExtraZWNJ(Trimmed, k) == false)
+            Positions[Kept.at(First + k)] = Position++;
+    return Positions;
+}
 
+/**
+ * @brief finds and tags some patterns in input text and converts them to  ixml format.
+ * @param _inStr  input string
+ * @param _lang language for input argument of SpellCorrector class.
+ * @param _lineNo line number
+ * @param _interactive argument of spellCorrector and normalizer. can SpellCorrector or Normalizer class be done interactively or not.
+ * @param _useSpellCorrector use spell corrector or not.
+ * @param _tags if provided, tags of output are stored in it too.
+ * @param _alignment if provided, it will be filled with span of input text which each token or tag of output is
+ * produced from.
+ * @param _detectRemovedTags if false, stages which detect entities of _removingTags are skipped.
+ * @return returns converted ixml text.
+ */
+QString IXMLWriter::convert2IXML(const QString &_inStr,
+                                 bool &_spellCorrected,
+                                 stuIXMLTagList* _tags,
+                                 const QList<enuTextTags::Type> _removingTags,
+                                 const QString& _lang,
+                                 quint32 _lineNo,
+                                 bool _interactive,
+                                 bool _useSpellCorrector,
+                                 bool _setTagValue,
+                                 bool _convertToLower,
+                                 bool _detectSymbols,
+                                 bool _setTagIndex,
+                                 QVector<stuTextAlignment>* _alignment,
+                                 bool _detectRemovedTags)
+{
     QSet<enuTextTags::Type> IgnoreTags = QSet<enuTextTags::Type>::fromList(_removingTags);
 
+    quint32 SkippedKinds = 0;
+    if (_detectRemovedTags == false && IgnoreTags.size())
+        for (int Kind = 0; Kind < stuTaggedEntities::KindCount; ++Kind){
+            enuTextTags::Type TagType = tagTypeOf(static_cast<stuTaggedEntities::enuKind>(Kind));
+            if (TagType != enuTextTags::Unknown && IgnoreTags.contains(TagType))
+                SkippedKinds |= stuTaggedEntities::kindMask(static_cast<stuTaggedEntities::enuKind>(Kind));
+        }
+
+    stuTaggedEntities Entities;     //values of found entities in order of their appearance.
+    SourceMap Map;
+    QString InputPhrase = this->prepare(_inStr,
+                                        Entities,
+                                        _spellCorrected,
+                                        _lang,
+                                        _lineNo,
+                                        _interactive,
+                                        _useSpellCorrector,
+                                        _detectSymbols,
+                                        SkippedKinds,
+                                        _alignment ? &Map : nullptr);
+    if (_alignment)
+        _alignment->clear();
+    if (InputPhrase.isEmpty())
+        return "";
+
+    StageTimer Timer(this->StageIDs.Render);
+
+    //replace placeholders with their corresponding words, wrapped with xml tags.
+    QString OutputPhrase;
+    OutputPhrase.reserve(InputPhrase.size() * 2);
+
+    if(_tags){
+        _tags->clear();
+        _tags->IndexedTags = _setTagIndex;
+    }
+
     enuTextTags::Type TagType;
     QString TagValue;
-    bool IsTag;
     QMap<enuTextTags::Type, int> TagCounts;
-    foreach (const QString& Token, InputPhrase.split(" ",QString::SkipEmptyParts)) {
-        IsTag = true;
-        if(Token == "TGMNEML"){
-            TagType = enuTextTags::Email;
-            TagValue = LstEmail.takeFirst();                
-        }
-        else if(Token == "TGMNURL"){
-            TagType = enuTextTags::URL;
-            TagValue = LstURL.takeFirst();
-        }
-        else if(Token == "TGMNABD"){
-            TagType = enuTextTags::Abbreviation;
-            TagValue = LstAbbr[0].takeFirst();
-        }
-        // else if(Token == "TGMNABR"){
-        //     TagType = enuTextTags::Abbreviation;
-        //     TagValue = LstAbbr[1].takeFirst();
-        // }
-        // else if(Token == "TGMNABS"){
-        //     TagType = enuTextTags::Abbreviation;
-        //     TagValue = LstAbbr[2].takeFirst();
-        // }
-        else if(Token == "TGMNDAT"){
-            TagType = enuTextTags::Date;
-            TagValue = LstDate.takeFirst();
-        }
-        else if(Token == "TGMNTIM"){
-            TagType = enuTextTags::Time;
-            TagValue = LstTime.takeFirst();
-        }
-        else if(Token == "TGMNORD"){
-            //TagType = enuTextTags::Ordinals;
-            TagValue = LstOrdinal.takeFirst();            
-            if(_convertToLower)
-                TagValue = TagValue.toLower();
-            OutputPhrase.append(TagValue);
-            IsTag = false;
-        }
-        else if(Token == "TGMNSNM"){
-            TagType = enuTextTags::SpecialNumber;
-            TagValue = LstSpecialNumber.takeFirst();
-        }
-        else if(Token == "TGMNNUL"){
-            TagType = enuTextTags::Number;
-            TagValue = LstNumberLeft.takeFirst();
-        }
-        else if(Token == "TGMNNUR"){
-            TagType = enuTextTags::Number;
-            TagValue = LstNumberRight.takeFirst();
-        }
-        else if(Token == "TGMNOLI"){
-            TagType = enuTextTags::OrderedListItem;
-            TagValue = LstOrderedItem.takeFirst();
-        }
-        else if(Token == "TGMNSYM"){
-            TagType = enuTextTags::Symbol;
-            TagValue = LstSymbols.takeFirst();
-        }
-        else if(Token == "TGMNMDT"){
-            OutputPhrase.append(MULTI_DOT);
-            IsTag = false;
-        }
-        else if(Token == "TGMNSFX"){
-            TagValue = LstSuffixes.takeFirst();
-            if(_convertToLower)
-                TagValue = TagValue.toLower();
-            OutputPhrase.append(TagValue);
-            IsTag = false;
-        }
-        else if(Token == "<"){
-            OutputPhrase.append("&lt;");
-            IsTag = false;
-        }
-        else if(Token == ">"){
-            OutputPhrase.append("&gt;");
-            IsTag = false;
-        }
-        else if(Token == "&"){
-            OutputPhrase.append("&amp;");
-            IsTag = false;
-        }
-        else{            
-            OutputPhrase.append(_convertToLower
-                                    ? Token.toLower()
-                                    : Token);
-            IsTag = false;                
+    quint64 RenderedTags = 0;
+    stuTaggedEntities::stuCursors Cursors;
+    QVector<stuTextAlignment> Rendered;     //Alignment of each token to output before final trimming
+    const QChar* Data = InputPhrase.constData();
+    int Size = InputPhrase.size();
+    int TokenEnd = 0;
+    for (int TokenStart = 0; TokenStart < Size; TokenStart = TokenEnd) {
+        if (Data[TokenStart] == ' '){
+            TokenEnd = TokenStart + 1;
+            continue;
         }
-        if(IsTag){
+        for (TokenEnd = TokenStart + 1; TokenEnd < Size && Data[TokenEnd] != ' '; ++TokenEnd);
+        const QChar* Token = Data + TokenStart;
+        int TokenLength = TokenEnd - TokenStart;
+        int RenderStart = OutputPhrase.size();
+
+        if (resolveEntity(Token, TokenLength, Entities, Cursors, TagType, TagValue)){
             if(_convertToLower)
                 TagValue = TagValue.toLower();
-            if(IgnoreTags.contains(TagType))
+            if(TagType == enuTextTags::Unknown || IgnoreTags.contains(TagType))
                 OutputPhrase.append(TagValue);
             else {
                 int TagIndex = TagCounts.value(TagType, -1);
                 TagIndex++;
                 TagCounts.insert(TagType, TagIndex);
-                replaceTag(OutputPhrase, TagType, TagValue,_putXmlTagsInSeperateList,_lstXmlTags,_setTagValue, TagIndex, _setTagIndex);
+                ++RenderedTags;
+                replaceTag(OutputPhrase, TagType, TagValue, _tags, _setTagValue, TagIndex, _setTagIndex);
             }
         }
+        else if(TokenLength == 1 && *Token == '<')
+            OutputPhrase.append("&lt;");
+        else if(TokenLength == 1 && *Token == '>')
+            OutputPhrase.append("&gt;");
+        else if(TokenLength == 1 && *Token == '&')
+            OutputPhrase.append("&amp;");
+        else if(_convertToLower)
+            OutputPhrase.append(QString::fromRawData(Token, TokenLength).toLower());
+        else
+            OutputPhrase.append(Token, TokenLength);
+
+        if (_alignment){
+            stuSourceSpan Span = Map.span(TokenStart, TokenLength);
+            Rendered.append(stuTextAlignment(RenderStart,
+                                             OutputPhrase.size() - RenderStart,
+                                             Span.Begin,
+                                             Span.End - Span.Begin));
+        }
         OutputPhrase.append(" ");
     }
     TargomanDebug(7,"[TRP] |"<<OutputPhrase<<"|");
 
+    if (_alignment){
+        QVector<int> Positions = finalPositions(OutputPhrase);
+        foreach (const stuTextAlignment& Token, Rendered){
+            int First = -1, Last = -1;
+            for (int i = Token.OutputOffset; i < Token.OutputOffset + Token.OutputLength; ++i)
+                if (Positions.at(i) >= 0){
+                    if (First < 0)
+                        First = Positions.at(i);
+                    Last = Positions.at(i);
+                }
+            if (First >= 0)
+                _alignment->append(stuTextAlignment(First, Last - First + 1, Token.SourceOffset, Token.SourceLength));
+        }
+    }
+
     OutputPhrase.truncate(OutputPhrase.size() - 2);
     OutputPhrase = this->NormalizerInstance.fullTrim(OutputPhrase.replace("  "," ").replace("  "," "));
+    Timer.finish(RenderedTags);
     TargomanDebug(7,"[ALL-TAGS] |"<<OutputPhrase<<"|");
 
     return OutputPhrase;
 }
 
-QString IXMLWriter::supportedSuffixes() const
-{
-    return TGMN_SUFFIXES;
-}
-
 /**
- * @brief Finds a RegExp in input _phrase and if found, replaces that with a _mark and adds that to _listOfMaches.
- * @param _phrase input phrase.
- * @param _regex pattern to search for.
- * @param _mark replacement string
- * @param _listOfMatches list to add.
- * @param _capID id of group in regular expression.
- * @return returns replaced string with mark.
+ * @brief processes input text the same way as convert2IXML() but stores tokens and their tags in a token stream
+ * instead of rendering them as ixml. Tokens are processed in non-interactive mode.
+ * @param _stream output stream, it is cleared before processing.
  */
-QString IXMLWriter::markByRegex(const QString &_phrase,
-                                const QRegularExpression& _regex,
-                                const QString &_mark,
-                                QStringList* _listOfMatches,
-                                quint8 _capID)
+void IXMLWriter::convert2Tokens(const QString &_inStr,
+                                stuTokenStream &_stream,
+                                bool &_spellCorrected,
+                                const QString &_lang,
+                                quint32 _lineNo,
+                                bool _useSpellCorrector,
+                                bool _convertToLower,
+                                bool _detectSymbols)
 {
-    int Pos=0;
-    int Start=0;
-    QString OutputPhrase;
-    QRegularExpressionMatch Match;
-
-    while((Pos = _phrase.indexOf(_regex, Pos, &Match)) != -1){
-        QString A = Match.captured(_capID);
-        if (_listOfMatches)
-            _listOfMatches->append(Match.captured(_capID));
-        OutputPhrase += _phrase.mid(Start,Pos - Start) + " " +
-                (_capID == 2 ? Match.captured(1) : "") + " TGMN" + _mark + " ";
-        Start = Pos + Match.capturedLength();
-        Pos += Match.capturedLength();
-    }
+    _stream.clear();
+
+    stuTaggedEntities Entities;
+    SourceMap Map;
+    QVector<stuTokenRange> SpellAlignment;
+    bool SpellCorrected = false;
+    QString Phrase = this->prepare(_inStr,
+                                   Entities,
+                                   SpellCorrected,
+                                   _lang,
+                                   _lineNo,
+                                   false,
+                                   _useSpellCorrector,
+                                   _detectSymbols,
+                                   0,
+                                   &Map,
+                                   &SpellAlignment);
+    _spellCorrected = SpellCorrected;
+    if (Phrase.isEmpty())
+        return;
+
+    _stream.Buffer.reserve(Phrase.size() * 2);
 
-    /*while ((Pos = _regex.indexIn(_phrase, Pos)) != -1) {
-        QString A = _regex.cap(_capID);
-        if (_listOfMatches)
-            _listOfMatches->append(_regex.cap(_capID));
-        OutputPhrase += _phrase.mid(Start,Pos - Start) + " " +
-                (_capID == 2 ? _regex.cap(1) : "") + " TGMN" + _mark + " ";
-        Start = Pos + _regex.matchedLength();
-        Pos += _regex.matchedLength();
-    }
-    */
+    enuTextTags::Type TagType;
+    QString Text;
+    stuTaggedEntities::stuCursors Cursors;
+    const QChar* Data = Phrase.constData();
+    int Size = Phrase.size();
+    // Last token is the dot which was appended by prepare()
+    int DotStart = Size;
+    while (DotStart > 0 && Data[DotStart - 1] == ' ')
+        --DotStart;
+    while (DotStart > 0 && Data[DotStart - 1] != ' ')
+        --DotStart;
+    int TokenIndex = -1;
+    int TokenEnd = 0;
+    for (int TokenStart = 0; TokenStart < Size; TokenStart = TokenEnd){
+        if (Data[TokenStart] == ' '){
+            TokenEnd = TokenStart + 1;
+            continue;
+        }
+        for (TokenEnd = TokenStart + 1; TokenEnd < Size && Data[TokenEnd] != ' '; ++TokenEnd);
+        if (TokenStart == DotStart)
+            break;
+        ++TokenIndex;
+        const QChar* Token = Data + TokenStart;
+        int TokenLength = TokenEnd - TokenStart;
+
+        if (resolveEntity(Token, TokenLength, Entities, Cursors, TagType, Text) == false){
+            TagType = enuTextTags::Unknown;
+            Text = QString(Token, TokenLength);
+        }
+        if (_convertToLower)
+            Text = Text.toLower();
+        Text = Normalizer::fullTrim(Text);
+        if (Text.isEmpty())
+            continue;
 
-    OutputPhrase += _phrase.mid(Start);
+        stuSourceSpan Span = Map.span(TokenStart, TokenLength);
+        if (_stream.Buffer.size())
+            _stream.Buffer.append(' ');
+        _stream.Tokens.append(stuTextToken(_stream.Buffer.size(),
+                                           Text.size(),
+                                           TagType,
+                                           SpellAlignment.size() && SpellAlignment.at(TokenIndex).Changed,
+                                           Span.Begin,
+                                           Span.End - Span.Begin));
+        _stream.Buffer.append(Text);
+    }
+}
 
-    TargomanDebug(7,"["<<_mark<<"] |"<<OutputPhrase<<"|");
-    return OutputPhrase;
+QString IXMLWriter::supportedSuffixes()
+{
+    return TGMN_SUFFIXES;
 }
 
 }
@@ -32,6 +32,10 @@
 #include "../TextProcessor.h"
 #include "Normalizer.h"
 #include "SpellCorrector.h"
+#include "EntityTagger.h"
+#include "AbbreviationMatcher.h"
+#include "URLMatcher.h"
+#include "PipelineStats.h"
 #include <functional>
 
 namespace Targoman {
@@ -57,21 +61,13 @@ TARGOMAN_ADD_EXCEPTION_HANDLER(exIXMLWriter, exTextProcessor);
 class IXMLWriter
 {
 public:
-
-    /**
-     * @brief Makes (if needed) and return an initialized instance of this class.
-     */
-    static IXMLWriter& instance(){
-        static IXMLWriter* Instance = NULL;
-        return *(Q_LIKELY(Instance) ? Instance : (Instance = new IXMLWriter));
-    }
+    IXMLWriter(Normalizer& _normalizer, SpellCorrector& _spellCorrector);
 
     void init(const QString &_configFile);
 
     QString convert2IXML(const QString& _inStr,
-                         INOUT bool& _spellCorrected,                         
-                         bool _putXmlTagsInSeperateList,
-                         QVariantList* _lstXmlTags,
+                         INOUT bool& _spellCorrected,
+                         stuIXMLTagList* _tags,
                          const QList<enuTextTags::Type> _removingTags,
                          const QString& _lang = "",
                          quint32 _lineNo = 0,
@@ -80,70 +76,86 @@ public:
                          bool _setTagValue = true,
                          bool _convertToLower = false,
                          bool _detectSymbols = true,
-                         bool _setTagIndex = false);
-    QString supportedSuffixes() const;
+                         bool _setTagIndex = false,
+                         QVector<stuTextAlignment>* _alignment = nullptr,
+                         bool _detectRemovedTags = true);
+    void convert2Tokens(const QString& _inStr,
+                        INOUT stuTokenStream& _stream,
+                        INOUT bool& _spellCorrected,
+                        const QString& _lang = "",
+                        quint32 _lineNo = 0,
+                        bool _useSpellCorrector = true,
+                        bool _convertToLower = false,
+                        bool _detectSymbols = true);
+    static QString supportedSuffixes();
 
 private:
-
-
-
-    QString markByRegex(const QString &_phrase,
-                        const QRegularExpression &_regex,
-                        const QString &_mark,
-                        QStringList *_listOfMatches,
-                        quint8 _capID = 0);
+    QString prepare(const QString& _inStr,
+                    INOUT stuTaggedEntities& _entities,
+                    INOUT bool& _spellCorrected,
+                    const QString& _lang,
+                    quint32 _lineNo,
+                    bool _interactive,
+                    bool _useSpellCorrector,
+                    bool _detectSymbols,
+                    quint32 _skippedKinds = 0,
+                    SourceMap* _map = nullptr,
+                    QVector<stuTokenRange>* _spellAlignment = nullptr);
+
+    static bool resolveEntity(const QChar* _token,
+                              int _length,
+                              const stuTaggedEntities& _entities,
+                              INOUT stuTaggedEntities::stuCursors& _cursors,
+                              INOUT enuTextTags::Type& _tagType,
+                              INOUT QString& _value);
+
+    void compileTaggingStages();
 
     inline void replaceTag(QString& _output,
                            enuTextTags::Type _type,
                            const QString& _value,
-                           bool _putXmlTagsInList,
-                           QVariantList* _lstXmlTags, 
+                           stuIXMLTagList* _tags,
                            bool _setTagValue,
                            int _index,
                            bool _setIndex){
-        QString Tag;
-        QString TagString;
-
-        if(_setIndex)
-            TagString = QString("%1-%2").arg(enuTextTags::toStr(_type)).arg(_index).toLower();
-        else
-            TagString = QString("%1").arg(enuTextTags::toStr(_type)).toLower();
-        
-        if(_setTagValue)
-            Tag = QString("<%1>%2</%1>").arg(TagString).arg(_value);        
-        else
-            Tag = QString("<%1>").arg(TagString);
-        
-
-        if(_putXmlTagsInList)
-        {
-            _output.append(Tag);
-            QJsonObject TagValue;
-            TagValue.insert("t",QJsonValue(QString("<%1>").arg(TagString)));
-            TagValue.insert("v",QJsonValue(_value));
-            _lstXmlTags->append(TagValue.toVariantMap());
-        }
-        else
-        {
-            _output.append(Tag);
-        }        
-    }
-
-
-
+        QString TagName = _setIndex ?
+                              QString("%1-%2").arg(enuTextTags::toStr(_type)).arg(_index).toLower() :
+                              QString(enuTextTags::toStr(_type)).toLower();
 
+        _output.append('<').append(TagName).append('>');
+        if(_setTagValue)
+            _output.append(_value).append("</").append(TagName).append('>');
 
+        if(_tags)
+            _tags->append(_type, _index, _value);
+    }
 
 private:
-    IXMLWriter();
     Q_DISABLE_COPY(IXMLWriter)
 
+    /**
+     * @brief ids of fixed stages of pipeline in PipelineStats. Entity detection stages are registered by Tagger.
+     */
+    struct stuStageIDs{
+        int Normalize;
+        int Numbering;
+        int PersianNumber;
+        int ScriptSplit;
+        int Tokenize;
+        int SpellCorrect;
+        int Render;
+    };
+
 
 private:
     QTextStream* TempStream;
     QTextStream* InStream;
     QTextStream* FinalOutStream;
-    QString      AbbreviationDetectionRegexPattern;
+    AbbreviationMatcher Abbreviations;      /** Abbreviations dictionary compiled on init */
+    URLMatcher          URLs;               /** Linear time matcher of URLs and IPs */
+    EmailMatcher        Emails;             /** Linear time matcher of e-mail addresses */
+    EntityTagger Tagger;                    /** Entity detection stages compiled on init */
+    stuStageIDs StageIDs;                   /** Ids of fixed stages registered on init */
     Normalizer& NormalizerInstance;         /** An instance of Normalizer class for faster access */
     SpellCorrector& SpellCorrectorInstance; /** An instance of SpellCorrector class for faster access */
 };
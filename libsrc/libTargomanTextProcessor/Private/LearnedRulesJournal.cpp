@@ -0,0 +1,216 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "LearnedRulesJournal.h"
+
+#ifdef Q_OS_UNIX
+#include <unistd.h>
+#endif
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief Escapes field separators so each rule fits in a single tab separated line.
+ */
+static QString escapeField(const QString& _field)
+{
+    QString Escaped;
+    Escaped.reserve(_field.size());
+    foreach (const QChar& Char, _field){
+        switch (Char.unicode()){
+        case '\\': Escaped += "\\\\"; break;
+        case '\t': Escaped += "\\t"; break;
+        case '\n': Escaped += "\\n"; break;
+        case '\r': Escaped += "\\r"; break;
+        default:   Escaped += Char;
+        }
+    }
+    return Escaped;
+}
+
+static QString unescapeField(const QString& _field)
+{
+    QString Unescaped;
+    Unescaped.reserve(_field.size());
+    for (int i = 0; i < _field.size(); ++i){
+        if (_field.at(i) != '\\' || i + 1 == _field.size()){
+            Unescaped += _field.at(i);
+            continue;
+        }
+        switch (_field.at(++i).unicode()){
+        case 't': Unescaped += '\t'; break;
+        case 'n': Unescaped += '\n'; break;
+        case 'r': Unescaped += '\r'; break;
+        default:  Unescaped += _field.at(i);
+        }
+    }
+    return Unescaped;
+}
+
+LearnedRulesJournal::LearnedRulesJournal() :
+    PendingRules(0)
+{}
+
+LearnedRulesJournal::~LearnedRulesJournal()
+{
+    QMutexLocker Locker(&this->Lock);
+    if (this->File.isOpen()){
+        // Destructor must not throw, closing the file is the last chance of pending rules to reach the disk
+        try{
+            this->syncUnlocked();
+        }catch(...){
+            TargomanLogWarn(5, "Unable to sync learned rules journal: <" + this->FilePath + ">");
+        }
+        this->File.close();
+    }
+}
+
+/**
+ * @brief sets path of journal file. Journal file is created on first append.
+ * @exception throws exception if rules pending in previous journal can not be synced.
+ */
+void LearnedRulesJournal::setFilePath(const QString &_filePath)
+{
+    QMutexLocker Locker(&this->Lock);
+    if (this->File.isOpen()){
+        this->syncUnlocked();
+        this->File.close();
+    }
+    this->FilePath = _filePath;
+}
+
+/**
+ * @brief Reads all rules stored in journal in the order they were learned.
+ * @return list of learned rules or an empty list if journal does not exist.
+ * @exception throws exception if journal exists but can not be read.
+ */
+QList<stuLearnedRule> LearnedRulesJournal::replay() const
+{
+    QMutexLocker Locker(&this->Lock);
+    QList<stuLearnedRule> Rules;
+    if (this->FilePath.isEmpty() || QFile::exists(this->FilePath) == false)
+        return Rules;
+
+    QFile JournalFile(this->FilePath);
+    if (!JournalFile.open(QIODevice::ReadOnly))
+        throw exLearnedRulesJournal("Unable to open learned rules journal: <" + this->FilePath + ">");
+
+    int LineNumber = 0;
+    while (!JournalFile.atEnd()){
+        QByteArray Line = JournalFile.readLine();
+        LineNumber++;
+        if (Line.endsWith('\n') == false){
+            TargomanLogWarn(5, "Ignoring incomplete rule at end of <" + this->FilePath + ">");
+            break;
+        }
+        QStringList Fields = QString::fromUtf8(Line.constData(), Line.size() - 1).split('\t');
+        if (Fields.size() != 3){
+            TargomanLogWarn(5, QString("Ignoring invalid rule at line %1 of <%2>").arg(LineNumber).arg(this->FilePath));
+            continue;
+        }
+        Rules.append(stuLearnedRule(unescapeField(Fields.at(0)),
+                                    unescapeField(Fields.at(1)),
+                                    unescapeField(Fields.at(2))));
+    }
+    return Rules;
+}
+
+/**
+ * @brief Appends a rule to journal using a single write. Journal is synced to disk when enough rules are pending
+ * or enough time has passed since last sync.
+ * @exception throws exception if journal can not be opened or written.
+ */
+void LearnedRulesJournal::append(const stuLearnedRule &_rule)
+{
+    QByteArray Line = (escapeField(_rule.Section) + '\t' +
+                       escapeField(_rule.Key) + '\t' +
+                       escapeField(_rule.Value) + '\n').toUtf8();
+
+    QMutexLocker Locker(&this->Lock);
+    if (this->File.isOpen() == false){
+        if (this->FilePath.isEmpty())
+            throw exLearnedRulesJournal("Learned rules journal path has not been set");
+        this->File.setFileName(this->FilePath);
+        if (!this->File.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered))
+            throw exLearnedRulesJournal("Unable to open learned rules journal: <" + this->FilePath + ">");
+        this->LastSync.start();
+    }
+    if (this->File.write(Line) != Line.size())
+        throw exLearnedRulesJournal("Unable to write to learned rules journal: <" + this->FilePath + ">");
+
+    if (++this->PendingRules >= LEARNED_RULES_JOURNAL_SYNC_BATCH ||
+        this->LastSync.elapsed() >= LEARNED_RULES_JOURNAL_SYNC_INTERVAL_MS)
+        this->syncUnlocked();
+}
+
+/**
+ * @brief Forces pending rules to be synced to disk.
+ */
+void LearnedRulesJournal::sync()
+{
+    QMutexLocker Locker(&this->Lock);
+    this->syncUnlocked();
+}
+
+/**
+ * @brief Removes all rules from journal. Must be called after rules have been folded into base rule files.
+ * @exception throws exception if journal can not be truncated.
+ */
+void LearnedRulesJournal::clear()
+{
+    QMutexLocker Locker(&this->Lock);
+    if (this->File.isOpen())
+        this->File.close();
+    this->PendingRules = 0;
+    if (QFile::exists(this->FilePath) && QFile::resize(this->FilePath, 0) == false)
+        throw exLearnedRulesJournal("Unable to clear learned rules journal: <" + this->FilePath + ">");
+}
+
+/**
+ * @brief Syncs appended rules to disk. Lock must be held by caller.
+ * @exception throws exception if rules can not be synced. Rules are kept pending so they are synced again later.
+ */
+void LearnedRulesJournal::syncUnlocked()
+{
+    if (this->File.isOpen() == false || this->PendingRules == 0)
+        return;
+#ifdef Q_OS_UNIX
+    if (::fsync(this->File.handle()) != 0)
+#else
+    if (this->File.flush() == false)
+#endif
+        throw exLearnedRulesJournal("Unable to sync learned rules journal: <" + this->FilePath + ">");
+    this->PendingRules = 0;
+    this->LastSync.restart();
+}
+
+}
+}
+}
+}
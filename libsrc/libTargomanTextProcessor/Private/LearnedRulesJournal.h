@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_LEARNEDRULESJOURNAL_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_LEARNEDRULESJOURNAL_H
+
+#include <QFile>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QList>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+TARGOMAN_ADD_EXCEPTION_HANDLER(exLearnedRulesJournal, exTextProcessor);
+
+/**
+ * @brief A single rule learned interactively.
+ */
+struct stuLearnedRule{
+    QString Section;                                    /** < Name of rule set which rule belongs to.*/
+    QString Key;
+    QString Value;
+
+    stuLearnedRule(const QString& _section = QString(),
+                   const QString& _key = QString(),
+                   const QString& _value = QString()) :
+        Section(_section),
+        Key(_key),
+        Value(_value)
+    {}
+};
+
+#define LEARNED_RULES_JOURNAL_SYNC_BATCH        32      /** < Max number of appended rules which are not synced to disk.*/
+#define LEARNED_RULES_JOURNAL_SYNC_INTERVAL_MS  1000    /** < Max time in milliseconds appended rules may stay unsynced.*/
+
+/**
+ * @brief The LearnedRulesJournal class keeps interactively learned rules in an append-only file beside rule files.
+ *
+ * Each rule is appended by a single write call, and the file is synced to disk in batches so learning a rule does
+ * not rewrite rule files. Owners replay the journal on init and merge it into their in-memory tables; compaction
+ * folds rules into base rule files and clears the journal. A partially written last line, left by a crash, is
+ * ignored on replay.
+ */
+class LearnedRulesJournal
+{
+public:
+    LearnedRulesJournal();
+    ~LearnedRulesJournal();
+
+    void setFilePath(const QString& _filePath);
+    inline const QString& filePath() const {return this->FilePath;}
+
+    QList<stuLearnedRule> replay() const;
+    void append(const stuLearnedRule& _rule);
+    void sync();
+    void clear();
+
+private:
+    Q_DISABLE_COPY(LearnedRulesJournal)
+    void syncUnlocked();
+
+private:
+    QString         FilePath;
+    QFile           File;                               /** < Opened on first append in unbuffered append mode.*/
+    int             PendingRules;                       /** < Number of rules appended since last sync.*/
+    QElapsedTimer   LastSync;
+    mutable QMutex  Lock;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_LEARNEDRULESJOURNAL_H
@@ -30,9 +30,13 @@
 #include <QTextStream>
 #include <QSettings>
 #include <iostream>
-#include <QCryptographicHash>
+#include <QSaveFile>
+#include <QMap>
+#include <QSet>
+#include <cstring>
 
 #include "Unicode.hpp"
+#include "UnknownCollector.h"
 
 //zhnDebug:
 #include <QtDebug>
@@ -42,10 +46,9 @@ namespace NLPLibs {
 namespace TargomanTP{
 namespace Private {
 
-Normalizer::Normalizer()
-{
-    initUnicodeNormalizers();
-}
+Normalizer::Normalizer() :
+    BinaryMode(false)
+{}
 
 #define POP_DIRECTIONAL_FORMATTING      QChar(0x202c)
 #define RIGHT_TO_LEFT_EMBEDDING         QChar(0x202b)
@@ -56,299 +59,728 @@ Normalizer::Normalizer()
 #define ARABIC_DECIMAL_POINT            QChar(0x066B)
 #define ARABIC_TATWEEL                  QChar(0x0640)
 
+#define NORMALIZER_BIN_MAGIC            "TGMNORM"
+#define NORMALIZER_BIN_VERSION          2
+
+/**
+ * @brief Header of binary normalization table. Header is followed by block index of action trie, fixed width
+ * stuNormalizationAction entries and then by UTF-16 string pool, all in native byte order so that the file can be
+ * used directly after mapping.
+ */
+struct stuBinTableHeader{
+    char    Magic[8];                                   /** < Must be NORMALIZER_BIN_MAGIC.*/
+    quint32 Version;                                    /** < Format version. Must be NORMALIZER_BIN_VERSION.*/
+    quint16 ByteOrderMark;                              /** < 0xFEFF in the byte order of machine which created file.*/
+    quint16 EntrySize;                                  /** < Size of each action entry.*/
+    quint32 EntryCount;                                 /** < Number of action entries.*/
+    quint32 PoolSize;                                   /** < Number of UTF-16 code units in string pool.*/
+    quint32 IndexSize;                                  /** < Number of entries in block index. Must be NORMALIZER_BLOCK_COUNT.*/
+    quint32 Reserved;                                   /** < Reserved for future use. Must be zero.*/
+    quint64 Checksum;                                   /** < Checksum of block index, entries and string pool.*/
+};
+static_assert(sizeof(stuBinTableHeader) == 40, "Binary table header must be 40 bytes");
+static_assert((NORMALIZER_BLOCK_COUNT * sizeof(quint16)) % 8 == 0, "Block index must keep entries aligned");
+static_assert(sizeof(stuNormalizationAction) == 8, "Binary table entries must be 8 bytes");
+
+/**
+ * @brief Computes a cheap 64bit FNV-1a like checksum over words of input buffer.
+ */
+static quint64 binTableChecksum(const uchar* _data, size_t _size){
+    quint64 Hash = Q_UINT64_C(0xcbf29ce484222325);
+    size_t i = 0;
+    for (; i + sizeof(quint64) <= _size; i += sizeof(quint64)){
+        quint64 Word;
+        memcpy(&Word, _data + i, sizeof(Word));
+        Hash = (Hash ^ Word) * Q_UINT64_C(0x100000001b3);
+    }
+    for (; i < _size; ++i)
+        Hash = (Hash ^ _data[i]) * Q_UINT64_C(0x100000001b3);
+    return Hash;
+}
+
+
+/**
+ * @brief Checks whether a code point is subject of context sensitive normalization rules or not.
+ */
+static inline bool isContextSensitive(uint _codePoint){
+    return _codePoint == ARABIC_ZWNJ.unicode() ||
+            _codePoint == POP_DIRECTIONAL_FORMATTING.unicode() ||
+            _codePoint == RIGHT_TO_LEFT_EMBEDDING.unicode() ||
+            _codePoint == ARABIC_TATWEEL.unicode() ||
+            _codePoint == ARABIC_THOUSAND_SEPERATOR.unicode() ||
+            _codePoint == WEIRD_THOUSAND_SEPERATOR.unicode() ||
+            _codePoint == WEIRD_DECIMAL_POINT.unicode() ||
+            _codePoint == ARABIC_DECIMAL_POINT.unicode() ||
+            _codePoint == ARABIC_YE_HAMZA.unicode() ||
+            _codePoint == ARABIC_ALEF_HAMZA_DOWN.unicode() ||
+            _codePoint == ARABIC_ALEF_HAMZA_UP.unicode();
+}
 
 /**
- * @brief Normalizes a character based on next char, last char, normalization config file and binary table.
- * @param _char character which should be normalized.
- * @param _nextChar next character
+ * @brief Normalizes a code point using action table in use. Arguments are same as overload which takes the table.
+ */
+void Normalizer::normalize(uint _codePoint,
+                           uint _nextCodePoint,
+                           stuNormalizationContext &_context,
+                           QString &_output,
+                           bool _interactive,
+                           quint32 _line,
+                           const QString &_phrase,
+                           size_t _charPos,
+                           bool _skipRecheck)
+{
+    ActionTablePtr_t Table = this->table();
+    Q_ASSERT_X(Table, "Initialized", "Seems that normalizer is not initialized");
+    this->normalize(*Table, _codePoint, _nextCodePoint, _context, _output, _interactive, _line, _phrase, _charPos,
+                    _skipRecheck);
+}
+
+/**
+ * @brief Normalizes a code point based on next code point, last code point and precompiled action table.
+ * @param _table action table which is used by caller.
+ * @param _codePoint code point which should be normalized.
+ * @param _nextCodePoint next code point
+ * @param _context normalization state of the phrase which is being normalized. It will be updated by this call.
+ * @param _output normalized form of code point will be appended to this buffer.
  * @param _interactive whether ask from user to define normal form of a unknown character or not?
  * @param _line line number
  * @param _phrase whole word.
  * @param _charPos character position.
  * @param _skipRecheck whether normalize again after normalization or not.
- * @return normalized form of character.
  */
-QString Normalizer::normalize(const QChar &_char,
-                              const QChar &_nextChar,
-                              bool _interactive,
-                              quint32 _line,
-                              const QString &_phrase,
-                              size_t _charPos,
-                              bool _skipRecheck)
+void Normalizer::normalize(const stuActionTable &_table,
+                           uint _codePoint,
+                           uint _nextCodePoint,
+                           stuNormalizationContext &_context,
+                           QString &_output,
+                           bool _interactive,
+                           quint32 _line,
+                           const QString &_phrase,
+                           size_t _charPos,
+                           bool _skipRecheck)
 {
-    QChar Char = _char;
-    bool NextCharIsNotLeftJoinable = (_nextChar.isSpace() ||
-                                      _nextChar.isSymbol() ||
-                                      _nextChar.isDigit() ||
-                                      _nextChar.isPunct() ||
-                                      _nextChar.isNull());
+    // //////////////////////////////////////////////////////////////////////////
+    // //                     Using Precompiled Action Table                  ///
+    // //////////////////////////////////////////////////////////////////////////
+    const stuNormalizationAction& Action = _table.action(_codePoint);
+
+    if ((Action.Flags & stuNormalizationAction::ContextSensitive) &&
+        this->normalizeByContext(_table, _codePoint, _nextCodePoint, _context, _line, _phrase, _charPos, _output))
+        return;
+
+    if (_skipRecheck && (Action.Flags & stuNormalizationAction::ScriptStage)){
+        appendCodePoint(_output, _context.LastCodePoint = (QChar::isTitleCase(_codePoint) ? QChar::toUpper(_codePoint) : _codePoint));
+        return;
+    }
+
+    if (_interactive && this->BinaryMode == false && (Action.Flags & stuNormalizationAction::Unresolved))
+        return this->normalizeInteractively(QChar::isTitleCase(_codePoint) ? QChar::toUpper(_codePoint) : _codePoint,
+                                            _nextCodePoint,
+                                            _context,
+                                            _line,
+                                            _phrase,
+                                            _charPos,
+                                            _output);
+
+    switch (Action.Action){
+    case enuNormalizationAction::Emit:
+        if (Action.Flags & stuNormalizationAction::Identity)
+            return appendCodePoint(_output, _context.LastCodePoint = _codePoint);
+        if (Action.Length == 0)
+            return;
+        _context.LastCodePoint = lastCodePoint(_table.Pool + Action.Offset, Action.Length);
+        _output.append(_table.Pool + Action.Offset, Action.Length);
+        return;
+
+    case enuNormalizationAction::EmitKeepContext:
+        if (Action.Flags & stuNormalizationAction::Identity)
+            return appendCodePoint(_output, _codePoint);
+        _output.append(_table.Pool + Action.Offset, Action.Length);
+        return;
+
+    case enuNormalizationAction::RedirectToZWNJ:
+        _context.LastCodePoint = ARABIC_ZWNJ.unicode();
+        return this->normalize(_table, ARABIC_ZWNJ.unicode(), _nextCodePoint, _context, _output, false, _line, _phrase,
+                               _charPos);
+
+    case enuNormalizationAction::Recheck:
+    {
+        const QChar* Expanded = _table.Pool + Action.Offset;
+        int i = 0;
+        while (i < Action.Length) {
+            uint ExpandedCodePoint = codePointAt(Expanded, Action.Length, i);
+            i += QChar::requiresSurrogates(ExpandedCodePoint) ? 2 : 1;
+            int Start = _output.size();
+            this->normalize(_table,
+                            ExpandedCodePoint,
+                            (i < Action.Length ? codePointAt(Expanded, Action.Length, i) : _nextCodePoint),
+                            _context,
+                            _output,
+                            _interactive,
+                            _line,
+                            _phrase,
+                            _charPos,
+                            true
+                            );
+            // Only first code point of each rechecked character is kept
+            if (_output.size() > Start){
+                _context.LastCodePoint = codePointAt(_output.constData(), _output.size(), Start);
+                _output.truncate(Start + (QChar::requiresSurrogates(_context.LastCodePoint) ? 2 : 1));
+            }
+        }
+        return;
+    }
+
+    default:
+        return appendCodePoint(_output, _codePoint);
+    }
+}
+
+/**
+ * @brief Normalizes a buffer of UTF-16 characters and appends result to output buffer. Runs of characters which
+ * are already normal are copied at once and no temporary string is allocated per character, so when output has
+ * enough reserved capacity nothing will be allocated in non-interactive mode.
+ * @param _data input buffer
+ * @param _size size of input buffer
+ * @param _context normalization state. It can be carried over consecutive calls which normalize parts of same phrase.
+ * @param _output normalized form of input will be appended to this buffer.
+ * @param _interactive can user interactively decide not resolve characters or not.
+ * @param _line line number
+ * @param _map if provided, source span of each appended character is appended to it. Offsets are relative to _data.
+ */
+void Normalizer::normalize(const QChar *_data,
+                           int _size,
+                           stuNormalizationContext &_context,
+                           QString &_output,
+                           bool _interactive,
+                           qint32 _line,
+                           SourceMap *_map)
+{
+    // Phrase is only needed to be shown to user in interactive mode
+    const QString Phrase = _interactive ? QString::fromRawData(_data, _size) : QString();
+    ActionTablePtr_t Table = this->table();
+    Q_ASSERT_X(Table, "Initialized", "Seems that normalizer is not initialized");
+    int i = 0;
+    while (i < _size){
+        // Copy runs of already normal characters at once
+        int RunLength = Table->NormalScanner.scan(_data + i, _size - i);
+        if (RunLength){
+            _output.append(_data + i, RunLength);
+            if (_map)
+                _map->appendIdentity(i, RunLength);
+            i += RunLength;
+            _context.LastCodePoint = _data[i - 1].unicode();
+            continue;
+        }
+        uint CodePoint = codePointAt(_data, _size, i);
+        int Next = i + (QChar::requiresSurrogates(CodePoint) ? 2 : 1);
+        // Unresolved characters are collected instead of blocking for user input
+        if (_interactive == false &&
+            this->BinaryMode == false &&
+            (Table->action(CodePoint).Flags & stuNormalizationAction::Unresolved) &&
+            UnknownCollector::instance().isActive())
+            UnknownCollector::instance().recordCharacter(CodePoint, _data, _size, i);
+        this->normalize(*Table,
+                        CodePoint,
+                        (Next < _size ? codePointAt(_data, _size, Next) : '\n'),
+                        _context,
+                        _output,
+                        _interactive,
+                        static_cast<quint32>(_line),
+                        Phrase,
+                        static_cast<size_t>(i));
+        if (_map)
+            _map->append(stuSourceSpan(i, Next), _output.size() - _map->size());
+        i = Next;
+        // Decisions of user replace the table, so they apply to rest of phrase too
+        if (_interactive)
+            Table = this->table();
+    }
+}
+
+/**
+ * @brief Applies multi char normalizers which depend on last and next code points.
+ * @param _output normalized form of code point will be appended to this buffer if any of rules is matched.
+ * @return true if any of context sensitive rules is matched.
+ */
+bool Normalizer::normalizeByContext(const stuActionTable &_table,
+                                    uint _codePoint,
+                                    uint _nextCodePoint,
+                                    stuNormalizationContext &_context,
+                                    quint32 _line,
+                                    const QString &_phrase,
+                                    size_t _charPos,
+                                    QString &_output)
+{
+    uint Char = _codePoint;
+    uint LastChar = _context.LastCodePoint;
+    bool NextCharIsNotLeftJoinable = (QChar::isSpace(_nextCodePoint) ||
+                                      QChar::isSymbol(_nextCodePoint) ||
+                                      QChar::isDigit(_nextCodePoint) ||
+                                      QChar::isPunct(_nextCodePoint) ||
+                                      _nextCodePoint == 0);
     // //////////////////////////////////////////////////////////////////////////
     // //                    Multi Char Normalizers                           ///
     // //////////////////////////////////////////////////////////////////////////
     // Remove extra non-breaking space after non-joinable characters and before space
-    if (Char == ARABIC_ZWNJ && (
-                this->LastChar.joining() == QChar::Right ||         //character that join just from their right side. like: د,ر,ا
-                this->LastChar.joining() == QChar::OtherJoining ||
-                this->LastChar.isSpace() ||
-                this->LastChar.isSymbol() ||
-                this->LastChar.isDigit()||
-                this->LastChar.isPunct() ||
-                this->LastChar.isNull() ||
+    if (Char == ARABIC_ZWNJ.unicode() && (
+                QChar::joining(LastChar) == QChar::Right ||         //character that join just from their right side. like: د,ر,ا
+                QChar::joining(LastChar) == QChar::OtherJoining ||
+                QChar::isSpace(LastChar) ||
+                QChar::isSymbol(LastChar) ||
+                QChar::isDigit(LastChar)||
+                QChar::isPunct(LastChar) ||
+                LastChar == 0 ||
                 NextCharIsNotLeftJoinable)){
-        return "";
+        return true;
     }
 
     //Temporarily accept [POP DIRECTIONAL FORMATTING] character as it maybe used for ZWNJ
-    if (Char == POP_DIRECTIONAL_FORMATTING){
-        this->LastChar = Char;
-        return "";
+    if (Char == POP_DIRECTIONAL_FORMATTING.unicode()){
+        _context.LastCodePoint = Char;
+        return true;
     }
 
     //Convert wrong tatweels to dash.
-    if(Char == ARABIC_TATWEEL && !(_nextChar.script() == QChar::Script_Arabic && this->LastChar.script() == QChar::Script_Arabic))
-            return this->LastChar = '-';
+    if(Char == ARABIC_TATWEEL.unicode() &&
+       !(QChar::script(_nextCodePoint) == QChar::Script_Arabic && QChar::script(LastChar) == QChar::Script_Arabic)){
+        _context.LastCodePoint = '-';
+        _output.append(QChar('-'));
+        return true;
+    }
 
     //Convert special ZWNJ to ZWNJ
-    if (Char == RIGHT_TO_LEFT_EMBEDDING && LastChar == POP_DIRECTIONAL_FORMATTING)
-        return this->normalize(this->LastChar = ARABIC_ZWNJ, _nextChar, false, _line, _phrase, _charPos);
+    if (Char == RIGHT_TO_LEFT_EMBEDDING.unicode() && LastChar == POP_DIRECTIONAL_FORMATTING.unicode()){
+        _context.LastCodePoint = ARABIC_ZWNJ.unicode();
+        this->normalize(_table, ARABIC_ZWNJ.unicode(), _nextCodePoint, _context, _output, false, _line, _phrase,
+                        _charPos);
+        return true;
+    }
 
     //Convert thousand separators to comma //zhnDebug: Arabic Thousand Seperator is same glyph as comma in some fonts like Tahoma. we can handle it.
-    if (LastChar.isDigit() && _nextChar.isDigit() && (
-                Char == ARABIC_THOUSAND_SEPERATOR ||
-                Char == WEIRD_THOUSAND_SEPERATOR))
-        return this->LastChar = ',';
+    if (QChar::isDigit(LastChar) && QChar::isDigit(_nextCodePoint) && (
+                Char == ARABIC_THOUSAND_SEPERATOR.unicode() ||
+                Char == WEIRD_THOUSAND_SEPERATOR.unicode())){
+        _context.LastCodePoint = ',';
+        _output.append(QChar(','));
+        return true;
+    }
 
     //Convert special decimal point
-    if (LastChar.isDigit() && _nextChar.isDigit() && (
-                Char == WEIRD_DECIMAL_POINT ||
-                Char == ARABIC_DECIMAL_POINT
-                ))
-        return this->LastChar = '.';
+    if (QChar::isDigit(LastChar) && QChar::isDigit(_nextCodePoint) && (
+                Char == WEIRD_DECIMAL_POINT.unicode() ||
+                Char == ARABIC_DECIMAL_POINT.unicode()
+                )){
+        _context.LastCodePoint = '.';
+        _output.append(QChar('.'));
+        return true;
+    }
 
     //convert ye hamze, if it is in its isolated or last form, to ye hamze.
-    if (Char == ARABIC_YE_HAMZA && (
-                NextCharIsNotLeftJoinable))
-        return this->LastChar = ARABIC_YE;
+    if (Char == ARABIC_YE_HAMZA.unicode() && (
+                NextCharIsNotLeftJoinable)){
+        _context.LastCodePoint = ARABIC_YE.unicode();
+        _output.append(ARABIC_YE);
+        return true;
+    }
 
     //convert alef hamza down or alef hamza up, if it is in its isolated or last form, to alef.
-    if ((Char == ARABIC_ALEF_HAMZA_DOWN || Char == ARABIC_ALEF_HAMZA_UP) && (
-                NextCharIsNotLeftJoinable))
-        return this->LastChar = ARABIC_ALEF;
-
-    // //////////////////////////////////////////////////////////////////////////
-    // //                        Using Binary Table                           ///
-    // //////////////////////////////////////////////////////////////////////////
-    if (this->BinaryMode){
-        Q_ASSERT_X(this->BinTable.size(), "Initialized", "Seems that normalizer is not initialized");
-        QString Normalized;
-        if (Char == ARABIC_ZWNJ ||
-            Char == POP_DIRECTIONAL_FORMATTING ||
-            Char == RIGHT_TO_LEFT_EMBEDDING ||
-            Char == ARABIC_THOUSAND_SEPERATOR ||
-            Char == WEIRD_THOUSAND_SEPERATOR ||
-            Char == WEIRD_DECIMAL_POINT)
-            Normalized = Char;
-        else
-            Normalized = this->BinTable.at(Char.unicode()).toString();
-
-        if (Normalized.size()){
-
-            if (_skipRecheck) {
-                this->LastChar = Normalized.at(Normalized.size() - 1);
-                return Normalized;
-            }
-            else {
-                QString TempNormalized = Normalized;
-                Normalized.clear();
-                for (int i = 0; i < TempNormalized.size(); i++) {
-                    QString NormalizedChar = this->normalize(TempNormalized.at(i),
-                                                             ((i + 1) < TempNormalized.size() ? TempNormalized.at(i+1) : _nextChar),
-                                                             _interactive,
-                                                             _line,
-                                                             _phrase,
-                                                             _charPos,
-                                                             true
-                                                             );
-                    if(NormalizedChar.size())
-                        Normalized.append(this->LastChar =  NormalizedChar[0]);
-                }
-                return Normalized;
-            }
-        }else{
-            return "";
-        }
+    if ((Char == ARABIC_ALEF_HAMZA_DOWN.unicode() || Char == ARABIC_ALEF_HAMZA_UP.unicode()) && (
+                NextCharIsNotLeftJoinable)){
+        _context.LastCodePoint = ARABIC_ALEF.unicode();
+        _output.append(ARABIC_ALEF);
+        return true;
     }
 
+    return false;
+}
+
+/**
+ * @brief Finds context free normal form of a code point using loaded rules. This method is used to compile action table.
+ * @param _codePoint code point which should be normalized.
+ * @param _skipRecheck whether normal form is needed in recheck mode or not.
+ * @param _flags ScriptStage and Unresolved flags will be added to this variable if needed.
+ * @param _normalized will be filled with normalized form of code point or expansion of script based normalizers.
+ * @return action which must be taken on normalized form.
+ */
+enuNormalizationAction::Type Normalizer::resolveCharacter(uint _codePoint,
+                                                          bool _skipRecheck,
+                                                          quint8 &_flags,
+                                                          QString &_normalized) const
+{
+    uint Char = _codePoint;
     // //////////////////////////////////////////////////////////////////////////
     // //                       Single Char Normalizers                       ///
     // //////////////////////////////////////////////////////////////////////////
 
     //Special characters
     if (Char == '\t' ||
-            Char == QChar(0xFFFF) || // Noncharacter
-            Char == QChar(0x7F))     // delete character
-        return " ";
+            Char == 0xFFFF || // Noncharacter
+            Char == 0x7F){    // delete character
+        _normalized = " ";
+        return enuNormalizationAction::EmitKeepContext;
+    }
 
     //Digits must be converted to ascii
-    if (Char.isDigit())
-        return this->LastChar = QChar(Char.digitValue() + '0');
+    if (QChar::isDigit(Char)){
+        _normalized = QChar(QChar::digitValue(Char) + '0');
+        return enuNormalizationAction::Emit;
+    }
 
     //Convert TitleCase to UpperCase
-    if (Char.isTitleCase())
-        Char = Char.toUpper();
+    if (QChar::isTitleCase(Char))
+        Char = QChar::toUpper(Char);
 
     //Convert all special forms of quote and dquote to ASCII
-    if (Char.category() == QChar::Punctuation_InitialQuote ||
-            Char.category() == QChar::Punctuation_FinalQuote)
-        return this->LastChar = '"';
+    if (QChar::category(Char) == QChar::Punctuation_InitialQuote ||
+            QChar::category(Char) == QChar::Punctuation_FinalQuote){
+        _normalized = '"';
+        return enuNormalizationAction::Emit;
+    }
 
     //Accept characters defined as white
-    if (this->WhiteList.contains (Char))
-        return this->LastChar = Char;
+    if (this->WhiteList.contains (Char)){
+        _normalized = codePoint2Str(Char);
+        return enuNormalizationAction::Emit;
+    }
 
     //Remove characters defined in config file
     if (this->RemovingList.contains(Char)){
-        return "";
+        _normalized = "";
+        return enuNormalizationAction::EmitKeepContext;
     }
 
     //Convert to normal Space characters marked as space
-    if (this->SpaceCharList.contains(Char))
-        return this->LastChar = ' ';
+    if (this->SpaceCharList.contains(Char)){
+        _normalized = ' ';
+        return enuNormalizationAction::Emit;
+    }
 
     //Convert to ZWNJ characters marked as ZWNJ
-    if (this->ZeroWidthSpaceCharList.contains(Char))
-        return this->normalize(this->LastChar = ARABIC_ZWNJ, _nextChar, false, _line, _phrase, _charPos);
+    if (this->ZeroWidthSpaceCharList.contains(Char)){
+        _normalized = ARABIC_ZWNJ;
+        return enuNormalizationAction::RedirectToZWNJ;
+    }
 
     //Convert characters based on Normalization table
     if (this->ReplacingTable.contains(Char)){
-        QString Buff = this->ReplacingTable.value(Char);
-        if (Buff.size() > 1){
-            this->LastChar = *(Buff.end() - 1);
-            return Buff;
-        }else
-            return this->LastChar = Buff.at(0);
+        _normalized = this->ReplacingTable.value(Char);
+        return enuNormalizationAction::Emit;
     }
 
     //Remove all special control characters and character modifiers
-    if (Char.category() == QChar::Letter_Modifier ||
-            Char.category() == QChar::Mark_NonSpacing ||
-            Char.category() == QChar::Symbol_Modifier){
-        return "";
+    if (QChar::category(Char) == QChar::Letter_Modifier ||
+            QChar::category(Char) == QChar::Mark_NonSpacing ||
+            QChar::category(Char) == QChar::Symbol_Modifier){
+        _normalized = "";
+        return enuNormalizationAction::EmitKeepContext;
     }
 
     //convert any non assigned character to empty set symbol.
-    if (Char.category() == QChar::Other_NotAssigned ||
-            Char.category() == QChar::Other_PrivateUse ||
-            Char.category() == QChar::Other_Surrogate)
-        return this->LastChar = SYMBOL_REMOVED;
-
-    if (_skipRecheck)
-        return this->LastChar = Char;
+    if (QChar::category(Char) == QChar::Other_NotAssigned ||
+            QChar::category(Char) == QChar::Other_PrivateUse ||
+            QChar::category(Char) == QChar::Other_Surrogate){
+        _normalized = SYMBOL_REMOVED;
+        return enuNormalizationAction::Emit;
+    }
 
+    _flags |= stuNormalizationAction::ScriptStage;
+    if (_skipRecheck){
+        _normalized = codePoint2Str(Char);
+        return enuNormalizationAction::Emit;
+    }
 
     //Check if there are sepcial normalizers
-
-    if (QCharScriptToNormalizerMap[Char.script()]){
-        QString TempNormalized = QCharScriptToNormalizerMap[Char.script()](Char.unicode());
-        QString Normalized;
-        for (int i=0; i < TempNormalized.size(); i++) {
-            QString NormalizedChar = this->normalize(TempNormalized.at(i),
-                                                     ((i + 1) < TempNormalized.size() ? TempNormalized.at(i+1) : _nextChar),
-                                                     _interactive,
-                                                     _line,
-                                                     _phrase,
-                                                     _charPos,
-                                                     true
-                                                     );
-            if(NormalizedChar.size())
-                Normalized.append(this->LastChar =  NormalizedChar[0]);
-        }
-        return Normalized;
+    ScriptBasedNormalizer ScriptNormalizer = scriptBasedNormalizer(QChar::script(Char));
+    if (ScriptNormalizer){
+        _normalized = ScriptNormalizer(Char);
+        return enuNormalizationAction::Recheck;
     }
 
     //Accept Currency, Math and special symbol characters
-    if (Char.category() == QChar::Symbol_Currency ||
-            Char.category() == QChar::Symbol_Math ||
-            Char.category() == QChar::Symbol_Other)
-        return this->LastChar = Char;
-
-    //Change not resolved characrters interactively by user input.
-    if(_interactive){
-        std::cout<<"Character <"<<QString(Char).toUtf8().constData()<<">(0x";
-        std::cout<<QString::number(Char.unicode(),16).toUpper().toLatin1().constData();
-        std::cout<<")["<<QCharCategorytToStringMap[Char.category()]<<"] [";
-        std::cout<<QCharScriptToStringMap[Char.script()];
-        std::cout<<"]could not be found in any list. What to do?"<<std::endl;
-        std::cout<<"Line: "<<_line<<": "<<std::endl;
-        std::cout<<_phrase.toUtf8().constData()<<std::endl;
-        std::cout<<QString(_charPos-1, '-').toLatin1().constData()<<"^"<<std::endl;
-
-        bool ValidSelection=false;
-        while (!ValidSelection)
-        {
-            std::cout<<"Press: (1: delete, 2: Accept, 3: Normalize, 4: Add as Space, 5: Add as ZWNJ, 6: Not Sure...)"<<std::endl;
-            QString Result = QChar((char)std::cin.get());
-            switch(Result.toInt ())
-            {
-            case 1:
-                this->RemovingList.insert(Char);
-                this->add2Configs (enuDicType::RemovingCharacters, Char);
-                ValidSelection = true;
-                break;
-            case 2:
-                this->WhiteList.insert(Char);
-                this->add2Configs (enuDicType::WhiteList, Char);
-                ValidSelection = true;
-                break;
-            case 4:
-                this->SpaceCharList.insert(Char);
-                this->add2Configs (enuDicType::SpaceCharacters, Char);
-                ValidSelection = true;
-                break;
-            case 5:
-                this->ZeroWidthSpaceCharList.insert(Char);
-                this->add2Configs (enuDicType::ZeroWidthSpaceCharacters, Char);
-                ValidSelection = true;
-                break;
-            case 6:
-                this->add2Configs (enuDicType::NotSure, Char);
-                ValidSelection = true;
-                break;
-            case 3:
-            {
-                std::string Buffer;
-
-                std::cout<<"Normalize <"<<QString(Char).toUtf8().constData()<<">(0x";
-                std::cout<<QString::number(Char.unicode(),16).toUpper().toLatin1().constData();
-                std::cout<<")["<<QCharCategorytToStringMap[Char.category()]<<"] [";
-                std::cout<<QCharScriptToStringMap[Char.script()] ;
-                std::cout<<"] to: "<<std::endl;
-                std::cin >>Buffer;
-                QString TempBuffer = QString::fromUtf8(Buffer.c_str());
-
-                if (TempBuffer.isEmpty())
-                    continue;
+    if (QChar::category(Char) == QChar::Symbol_Currency ||
+            QChar::category(Char) == QChar::Symbol_Math ||
+            QChar::category(Char) == QChar::Symbol_Other){
+        _normalized = codePoint2Str(Char);
+        return enuNormalizationAction::Emit;
+    }
 
-                if (TempBuffer.size() > 1){
-                    qCritical("Invalid normalization character. Modify config file manually to insert multi-char modifiers");
-                    continue;
-                }
-                this->ReplacingTable.insert(Char,TempBuffer.at(0));
-                this->add2Configs(enuDicType::ReplacingCharacters, Char, TempBuffer.at(0));
-                ValidSelection = true;
+    //Not resolved characters are kept as is unless they are defined interactively.
+    _flags |= stuNormalizationAction::Unresolved;
+    _normalized = codePoint2Str(Char);
+    return enuNormalizationAction::EmitKeepContext;
+}
+
+/**
+ * @brief Compiles action of a single code point and adds its normalized form to the string pool.
+ *
+ * Expansions of script based normalizers are rechecked at compile time unless they contain context sensitive
+ * characters, in which case recheck is postponed to normalization time.
+ * @param _dependents if provided, _codePoint is added as dependent of each other code point whose rules are used to
+ * compile its action.
+ */
+stuNormalizationAction Normalizer::compileAction(uint _codePoint,
+                                                 QString &_pool,
+                                                 QHash<QString, quint32> &_poolIndex,
+                                                 QMultiHash<uint, uint>* _dependents) const
+{
+    stuNormalizationAction Action;
+    QString Normalized;
+    Action.Flags = isContextSensitive(_codePoint) ? stuNormalizationAction::ContextSensitive : 0;
+    Action.Action = this->resolveCharacter(_codePoint, false, Action.Flags, Normalized);
+    // Rules of title case characters are looked up by their upper case form
+    if (_dependents && QChar::isTitleCase(_codePoint))
+        _dependents->insert(QChar::toUpper(_codePoint), _codePoint);
+
+    if (Action.Action == enuNormalizationAction::Recheck){
+        QString Rechecked;
+        bool Foldable = true;
+        foreach (uint ExpandedCodePoint, Normalized.toUcs4()){
+            if (_dependents && ExpandedCodePoint != _codePoint)
+                _dependents->insert(ExpandedCodePoint, _codePoint);
+            QString NormalizedChar;
+            quint8 Flags = 0;
+            if (isContextSensitive(ExpandedCodePoint) ||
+                this->resolveCharacter(ExpandedCodePoint, true, Flags, NormalizedChar) == enuNormalizationAction::RedirectToZWNJ){
+                Foldable = false;
                 break;
             }
-            default:
-                break;
+            if (NormalizedChar.size())
+                Rechecked.append(codePoint2Str(codePointAt(NormalizedChar.constData(), NormalizedChar.size(), 0)));
+        }
+        if (Foldable){
+            Action.Action = enuNormalizationAction::Emit;
+            Normalized = Rechecked;
+        }
+    }
+
+    if ((Action.Action == enuNormalizationAction::Emit || Action.Action == enuNormalizationAction::EmitKeepContext) &&
+        Normalized == codePoint2Str(_codePoint)){
+        // Characters which are kept as is do not need pool so blocks of them can be shared.
+        Action.Flags |= stuNormalizationAction::Identity;
+        Action.Length = 0;
+        Action.Offset = 0;
+        return Action;
+    }
+
+    if (Normalized.size() > 0xFFFF)
+        throw exNormalizer(QString("Normal form of <0x%1> is too long").arg(_codePoint, 0, 16));
+
+    Action.Length = static_cast<quint16>(Normalized.size());
+    if (_poolIndex.contains(Normalized))
+        Action.Offset = _poolIndex.value(Normalized);
+    else{
+        Action.Offset = static_cast<quint32>(_pool.size());
+        _poolIndex.insert(Normalized, Action.Offset);
+        _pool.append(Normalized);
+    }
+    return Action;
+}
+
+/**
+ * @brief Compiles loaded rules to an action table which covers all unicode planes and makes it current.
+ *
+ * Table is a two level trie: BMP blocks are stored first in order so BMP code points are looked up directly, and
+ * each block of supplementary planes is mapped by BlockIndex to a block which is shared between identical blocks.
+ */
+void Normalizer::compileActionTable()
+{
+    std::shared_ptr<stuActionTable> NewTable(new stuActionTable);
+    QVector<stuNormalizationAction>& Table = NewTable->ActionTable;
+    QVector<quint16>& BlockIndex = NewTable->BlockIndexTable;
+    QString& Pool = NewTable->ActionPool;
+    QHash<QString, quint32> PoolIndex;
+    QHash<QByteArray, quint16> SupplementaryBlocks;
+    QMultiHash<uint, uint> Dependents;
+
+    Table.resize(0x10000);
+    BlockIndex.resize(NORMALIZER_BLOCK_COUNT);
+    for (uint i=0; i<=0xFFFF; i++)
+        Table[static_cast<int>(i)] = this->compileAction(i, Pool, PoolIndex, &Dependents);
+    for (int i=0; i<0x100; i++)
+        BlockIndex[i] = static_cast<quint16>(i);
+
+    stuNormalizationAction Block[0x100];
+    for (uint BlockID = 0x100; BlockID < NORMALIZER_BLOCK_COUNT; BlockID++){
+        for (uint i=0; i<0x100; i++)
+            Block[i] = this->compileAction((BlockID << 8) | i, Pool, PoolIndex, &Dependents);
+        QByteArray Key(reinterpret_cast<const char*>(Block), sizeof(Block));
+        auto SharedBlock = SupplementaryBlocks.constFind(Key);
+        if (SharedBlock != SupplementaryBlocks.constEnd()){
+            BlockIndex[static_cast<int>(BlockID)] = SharedBlock.value();
+        }else{
+            quint16 NewBlock = static_cast<quint16>(Table.size() >> 8);
+            for (uint i=0; i<0x100; i++)
+                Table.append(Block[i]);
+            SupplementaryBlocks.insert(Key, NewBlock);
+            BlockIndex[static_cast<int>(BlockID)] = NewBlock;
+        }
+    }
+
+    NewTable->Actions = Table.constData();
+    NewTable->Pool = Pool.constData();
+    NewTable->BlockIndex = BlockIndex.constData();
+    prepareNormalScanner(*NewTable);
+    this->Dependents.swap(Dependents);
+    std::atomic_store(&this->Table, ActionTablePtr_t(NewTable));
+}
+
+/**
+ * @brief Recompiles actions of a code point whose rules have been changed and of code points which depend on it, in
+ * a copy of current table which replaces it at once.
+ *
+ * Supplementary blocks may be shared, so a patched supplementary block is copied to a new block first. Normalized
+ * forms are appended to the string pool without reusing existing ones.
+ */
+void Normalizer::patchActionTable(uint _codePoint)
+{
+    ActionTablePtr_t OldTable = this->table();
+    std::shared_ptr<stuActionTable> NewTable(new stuActionTable);
+    QVector<stuNormalizationAction>& Table = NewTable->ActionTable;
+    QVector<quint16>& BlockIndex = NewTable->BlockIndexTable;
+    QString& Pool = NewTable->ActionPool;
+    Table = OldTable->ActionTable;
+    BlockIndex = OldTable->BlockIndexTable;
+    Pool = OldTable->ActionPool;
+
+    QHash<QString, quint32> PoolIndex;
+    QList<uint> CodePoints = this->Dependents.values(_codePoint);
+    CodePoints.prepend(_codePoint);
+    QSet<int> PatchedBlocks;
+    foreach (uint CodePoint, CodePoints){
+        int Block = static_cast<int>(CodePoint >> 8);
+        if (CodePoint > 0xFFFF && PatchedBlocks.contains(Block) == false){
+            int From = static_cast<int>(BlockIndex.at(Block)) << 8;
+            quint16 NewBlock = static_cast<quint16>(Table.size() >> 8);
+            for (int i=0; i<0x100; i++){
+                stuNormalizationAction Action = Table.at(From + i);
+                Table.append(Action);
             }
+            BlockIndex[Block] = NewBlock;
+            PatchedBlocks.insert(Block);
         }
-        return normalize(Char, _nextChar, false, _line, _phrase, _charPos);
+        int Index = CodePoint > 0xFFFF ?
+                        (static_cast<int>(BlockIndex.at(Block)) << 8) | static_cast<int>(CodePoint & 0xFF) :
+                        static_cast<int>(CodePoint);
+        Table[Index] = this->compileAction(CodePoint, Pool, PoolIndex);
     }
-    else
-        return Char;
+
+    NewTable->Actions = Table.constData();
+    NewTable->Pool = Pool.constData();
+    NewTable->BlockIndex = BlockIndex.constData();
+    prepareNormalScanner(*NewTable);
+    std::atomic_store(&this->Table, ActionTablePtr_t(NewTable));
+}
+
+/**
+ * @brief Collects BMP characters which are normalized to themselves regardless of their context, so runs of them can
+ * be copied to output without calling per-character normalizer.
+ */
+void Normalizer::prepareNormalScanner(stuActionTable& _table)
+{
+    _table.NormalScanner.clear();
+    for (int i=0; i<=0xFFFF; i++){
+        const stuNormalizationAction& Action = _table.Actions[i];
+        if (Action.Action == enuNormalizationAction::Emit &&
+            (Action.Flags & stuNormalizationAction::Identity) &&
+            (Action.Flags & stuNormalizationAction::ContextSensitive) == 0)
+            _table.NormalScanner.add(static_cast<quint16>(i));
+    }
+    _table.NormalScanner.finalize();
 }
+
 /**
- * @brief calls main normalizer function character by character.
+ * @brief Asks user to define normal form of a character which could not be resolved by any rule.
+ * @param _output normalized form of character after applying user decision will be appended to this buffer.
+ */
+void Normalizer::normalizeInteractively(uint _codePoint,
+                                        uint _nextCodePoint,
+                                        stuNormalizationContext &_context,
+                                        quint32 _line,
+                                        const QString &_phrase,
+                                        size_t _charPos,
+                                        QString &_output)
+{
+    QMutexLocker Locker(&this->InteractiveLock);
+    uint Char = _codePoint;
+
+    // Another session may have defined it while waiting for lock
+    if ((this->table()->action(Char).Flags & stuNormalizationAction::Unresolved) == 0)
+        return this->normalize(Char, _nextCodePoint, _context, _output, false, _line, _phrase, _charPos);
+
+    std::cout<<"Character <"<<codePoint2Str(Char).toUtf8().constData()<<">(0x";
+    std::cout<<QString::number(Char,16).toUpper().toLatin1().constData();
+    std::cout<<")["<<categoryName(QChar::category(Char))<<"] [";
+    std::cout<<scriptName(QChar::script(Char));
+    std::cout<<"]could not be found in any list. What to do?"<<std::endl;
+    std::cout<<"Line: "<<_line<<": "<<std::endl;
+    std::cout<<_phrase.toUtf8().constData()<<std::endl;
+    std::cout<<QString(_charPos-1, '-').toLatin1().constData()<<"^"<<std::endl;
+
+    bool ValidSelection=false;
+    while (!ValidSelection)
+    {
+        std::cout<<"Press: (1: delete, 2: Accept, 3: Normalize, 4: Add as Space, 5: Add as ZWNJ, 6: Not Sure...)"<<std::endl;
+        QString Result = QChar((char)std::cin.get());
+        switch(Result.toInt ())
+        {
+        case 1:
+            this->RemovingList.insert(Char);
+            this->add2Configs (enuDicType::RemovingCharacters, Char);
+            ValidSelection = true;
+            break;
+        case 2:
+            this->WhiteList.insert(Char);
+            this->add2Configs (enuDicType::WhiteList, Char);
+            ValidSelection = true;
+            break;
+        case 4:
+            this->SpaceCharList.insert(Char);
+            this->add2Configs (enuDicType::SpaceCharacters, Char);
+            ValidSelection = true;
+            break;
+        case 5:
+            this->ZeroWidthSpaceCharList.insert(Char);
+            this->add2Configs (enuDicType::ZeroWidthSpaceCharacters, Char);
+            ValidSelection = true;
+            break;
+        case 6:
+            this->add2Configs (enuDicType::NotSure, Char);
+            ValidSelection = true;
+            break;
+        case 3:
+        {
+            std::string Buffer;
+
+            std::cout<<"Normalize <"<<codePoint2Str(Char).toUtf8().constData()<<">(0x";
+            std::cout<<QString::number(Char,16).toUpper().toLatin1().constData();
+            std::cout<<")["<<categoryName(QChar::category(Char))<<"] [";
+            std::cout<<scriptName(QChar::script(Char)) ;
+            std::cout<<"] to: "<<std::endl;
+            std::cin >>Buffer;
+            QVector<uint> TempBuffer = QString::fromUtf8(Buffer.c_str()).toUcs4();
+
+            if (TempBuffer.isEmpty())
+                continue;
+
+            if (TempBuffer.size() > 1){
+                qCritical("Invalid normalization character. Modify config file manually to insert multi-char modifiers");
+                continue;
+            }
+            this->ReplacingTable.insert(Char,codePoint2Str(TempBuffer.first()));
+            this->add2Configs(enuDicType::ReplacingCharacters, Char, TempBuffer.first());
+            ValidSelection = true;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    this->patchActionTable(Char);
+    this->normalize(Char, _nextCodePoint, _context, _output, false, _line, _phrase, _charPos);
+}
+/**
+ * @brief calls main normalizer function code point by code point.
  * @param _string input string
  * @param _line line number
  * @param _interactive can user interactively decide not resolve characters or not.
@@ -357,151 +789,231 @@ QString Normalizer::normalize(const QChar &_char,
 QString Normalizer::normalize(const QString &_string, qint32 _line, bool _interactive)
 {
     QString Normalized;
-    this->LastChar = QChar();
-    for (int i=0; i<_string.size(); i++){
-        QString normalizedCharString = this->normalize(_string.at(i),
-                                                       ((i + 1) < _string.size() ? _string.at(i+1) : QChar('\n')),
-                                                       _interactive,
-                                                       static_cast<quint32>(_line),
-                                                       _string,
-                                                       static_cast<size_t>(i));
-        Normalized.append(normalizedCharString);
-    }
+    Normalized.reserve(_string.size());
+    stuNormalizationContext Context;
+    this->normalize(_string.constData(), _string.size(), Context, Normalized, _interactive, _line);
     return fullTrim(Normalized);
 }
 
 /**
- * @brief adds interactively user inputs to normalization configuration file.
+ * @brief adds interactively user inputs to learned rules journal. Rules are folded into normalization configuration
+ * file by compactLearnedRules().
  * @param _type type of normalization (i.e. whitelist, removingCharacters, ...)
  * @param _originalChar original character
  * @param _replacement replacement character which is needed for ReplacingCharacters type.
+ * @exception throws exception if journal can not be written.
+ */
+void Normalizer::add2Configs(enuDicType::Type _type, uint _originalChar, uint _replacement)
+{
+    this->Journal.append(stuLearnedRule(enuDicType::toStr(_type),
+                                        this->char2Str(_originalChar, true),
+                                        _type == enuDicType::ReplacingCharacters ?
+                                            this->char2Str(_replacement, true) : QString()));
+}
+
+/**
+ * @brief Merges rules of learned rules journal into normalization tables. Must be called before action table is
+ * compiled.
+ * @exception throws exception if journal contains an invalid rule.
+ */
+void Normalizer::replayLearnedRules()
+{
+    this->Journal.setFilePath(this->ConfigFileName + ".journal");
+    QList<stuLearnedRule> Rules = this->Journal.replay();
+    foreach (const stuLearnedRule& Rule, Rules){
+        uint Char = this->str2CodePoints(Rule.Key, -1, false).first();
+        switch (enuDicType::toEnum(Rule.Section.toLatin1().constData())){
+        case enuDicType::WhiteList:
+            this->WhiteList.insert(Char);
+            break;
+        case enuDicType::RemovingCharacters:
+            this->RemovingList.insert(Char);
+            break;
+        case enuDicType::SpaceCharacters:
+            this->SpaceCharList.insert(Char);
+            break;
+        case enuDicType::ZeroWidthSpaceCharacters:
+            this->ZeroWidthSpaceCharList.insert(Char);
+            break;
+        case enuDicType::ReplacingCharacters:
+            this->ReplacingTable.insert(Char, codePoint2Str(this->str2CodePoints(Rule.Value, -1, false).first()));
+            break;
+        case enuDicType::NotSure:
+            break;
+        default:
+            throw exNormalizer("Invalid learned rule type: " + Rule.Section);
+        }
+    }
+    if (Rules.size())
+        TargomanLogInfo(5, QString("%1 learned normalization rules replayed from journal").arg(Rules.size()));
+}
+
+/**
+ * @brief Formats a learned rule as it must be written in normalization configuration file.
+ * @exception throws exception if type of normalization is invalid or "Unknown".
+ */
+QString Normalizer::learnedRuleLine(enuDicType::Type _type, uint _originalChar, uint _replacement)
+{
+    switch(_type){
+    case enuDicType::NotSure:
+    case enuDicType::WhiteList:
+    case enuDicType::RemovingCharacters:
+    case enuDicType::SpaceCharacters:
+    case enuDicType::ZeroWidthSpaceCharacters:
+    {
+        QString ToBeWritten = this->char2Str(_originalChar);
+        return (_type == enuDicType::NotSure ? "NEW " + ToBeWritten + "\n" : QString()) +
+                QString("NEW %1 ## %2 [%3][%4]\n").arg(
+                    ToBeWritten).arg(
+                    ToBeWritten.startsWith("<0x") ?
+                        QString("{%1}").arg(codePoint2Str(_originalChar)) :
+                        this->char2Str(_originalChar, true)).arg(
+                    categoryName(QChar::category(_originalChar))).arg(
+                    scriptName(QChar::script(_originalChar)));
+    }
+    case enuDicType::ReplacingCharacters:
+    {
+        QString ToBeWrittenKey = this->char2Str(_originalChar);
+        QString ToBeWrittenVal = this->char2Str(_replacement);
+        return QString("NEW %1 = %2 ## %3 ==> %4\n").arg(
+                    ToBeWrittenKey, ToBeWrittenVal).arg(
+                    ToBeWrittenKey.startsWith("<0x") ?
+                        QString("{%1}").arg(codePoint2Str(_originalChar)) :
+                        this->char2Str(_originalChar, true)).arg(
+                    ToBeWrittenVal.startsWith("<0x") ?
+                        QString("{%1}").arg(codePoint2Str(_replacement)) :
+                        this->char2Str(_replacement, true));
+    }
+    default:
+        throw exNormalizer("Invalid insertion Type");
+    }
+}
+
+/**
+ * @brief Folds rules of learned rules journal into normalization configuration file and clears the journal. Each
+ * rule is written at the end of its own section and previous config file is kept as backup. Lines which are already
+ * in their section are skipped, so compacting again after journal could not be cleared does not duplicate rules.
  * @exception throws exception if backup of config file can not be created.
- * @exception throws exception if config file can not be opened.
- * @exception throws exception if config file is not writable.
- * @exception throws exception if type of type of normalization is invalid or "Unknown".
+ * @exception throws exception if config file can not be read or written.
+ * @exception throws exception if config file or journal contains an invalid type.
  */
-void Normalizer::add2Configs(enuDicType::Type _type, QChar _originalChar, QChar _replacement)
+void Normalizer::compactLearnedRules()
 {
-    QFile ConfigFileOut(this->ConfigFileName);
+    QMutexLocker Locker(&this->InteractiveLock);
+    if (this->BinaryMode)
+        throw exNormalizer("Unable to compact learned rules when working in binary mode.");
+
+    this->Journal.sync();
+    QList<stuLearnedRule> Rules = this->Journal.replay();
+    if (Rules.isEmpty())
+        return;
+
+    QMap<enuDicType::Type, QByteArray> NewLines;
+    foreach (const stuLearnedRule& Rule, Rules){
+        enuDicType::Type Type = enuDicType::toEnum(Rule.Section.toLatin1().constData());
+        NewLines[Type].append(this->learnedRuleLine(
+                                  Type,
+                                  this->str2CodePoints(Rule.Key, -1, false).first(),
+                                  Rule.Value.isEmpty() ? 0 : this->str2CodePoints(Rule.Value, -1, false).first()
+                                  ).toUtf8());
+    }
+
     if(QFile::exists (this->ConfigFileName + ".back"))
         QFile::remove(this->ConfigFileName + ".back");
-    if (!ConfigFileOut.copy(this->ConfigFileName + ".back"))
+    if (!QFile::copy(this->ConfigFileName, this->ConfigFileName + ".back"))
         throw exNormalizer("Unable to backup normalization file");
 
     QFile ConfigFileIn(this->ConfigFileName + ".back");
-    ConfigFileIn.open(QIODevice::ReadOnly);
-    ConfigFileOut.open(QIODevice::WriteOnly);
-
-    if(!ConfigFileIn.isReadable ())
+    QSaveFile ConfigFileOut(this->ConfigFileName);
+    if(!ConfigFileIn.open(QIODevice::ReadOnly))
         throw exNormalizer("Unable to open backup normalization file.");
-    if(!ConfigFileOut.isWritable ())
+    if(!ConfigFileOut.open(QIODevice::WriteOnly))
         throw exNormalizer("Unable to open output normalization file.");
 
     QByteArray DataLine;
-    enuDicType::Type DicStep;
-    bool SectionFound= false;
-
+    enuDicType::Type Section = enuDicType::Unknown;
+    QSet<QByteArray> SectionLines;
     while (!ConfigFileIn.atEnd())
     {
         DataLine = ConfigFileIn.readLine().trimmed();
 
         if (DataLine.startsWith("[") && DataLine.endsWith("]")){
-            DicStep = enuDicType::toEnum(DataLine.mid(1,DataLine.size() - 2).constData());
-            if (DicStep == enuDicType::Unknown)
-                throw exNormalizer(QString("Invalid Dic Type: %1").arg(DataLine.constData()));
-            else if (DicStep == _type)
-                SectionFound=true;
-            else if(SectionFound && DicStep != _type){
-                // this happens when we have found correct sectoin, passed all lines of that and found the first line next section.
-                // So we are in the correct place to add config.
-                switch(_type){
-                case enuDicType::NotSure:
-                    ConfigFileOut.write(("NEW " + this->char2Str(_originalChar) + "\n").toUtf8());
-                    [[clang::fallthrough]];
-                case enuDicType::WhiteList:
-                case enuDicType::RemovingCharacters:
-                case enuDicType::SpaceCharacters:
-                case enuDicType::ZeroWidthSpaceCharacters:
-                {
-                    QString ToBeWritten = this->char2Str(_originalChar);
-                    ConfigFileOut.write(QString("NEW %1 ## %2 [%3][%4]\n").arg(
-                                            ToBeWritten).arg(
-                                            ToBeWritten.startsWith("<0x") ?
-                                                QString("{%1}").arg(_originalChar) :
-                                                this->char2Str(_originalChar, true)).arg(
-                                            QCharCategorytToStringMap[_originalChar.category()].c_str()).arg(
-                                            QCharScriptToStringMap[_originalChar.script()].c_str()).toUtf8());
-                }
-                    break;
-                case enuDicType::ReplacingCharacters:
-                {
-                    QString ToBeWrittenKey = this->char2Str(_originalChar);
-                    QString ToBeWrittenVal = this->char2Str(_replacement);
-                    ConfigFileOut.write(QString("NEW %1 = %2 ## %3 ==> %4\n").arg(
-                                            ToBeWrittenKey, ToBeWrittenVal).arg(
-                                            ToBeWrittenKey.startsWith("<0x") ?
-                                                QString("{%1}").arg(_originalChar) :
-                                                this->char2Str(_originalChar, true)).arg(
-                                            ToBeWrittenVal.startsWith("<0x") ?
-                                                QString("{%1}").arg(_replacement) :
-                                                this->char2Str(_replacement, true)).toUtf8());
-                }
-                    break;
-                default:
-                    throw exNormalizer("Invalid insertion Type");
-                }
-                SectionFound= false;
+            // Rules of previous section are written just before header of next section
+            foreach (QByteArray Line, NewLines.take(Section).split('\n')){
+                Line = Line.trimmed();
+                if (Line.isEmpty() || SectionLines.contains(Line))
+                    continue;
+                SectionLines.insert(Line);
+                ConfigFileOut.write(Line + "\n");
             }
+            SectionLines.clear();
+            Section = enuDicType::toEnum(DataLine.mid(1,DataLine.size() - 2).constData());
+            if (Section == enuDicType::Unknown)
+                throw exNormalizer(QString("Invalid Dic Type: %1").arg(DataLine.constData()));
         }
         ConfigFileOut.write (DataLine + "\n");
+        SectionLines.insert(DataLine);
     }
 
-    ConfigFileIn.close ();
-    ConfigFileOut.close ();
+    if (NewLines.size())
+        throw exNormalizer("Some learned rules have no section in normalization file");
+    if (!ConfigFileOut.commit())
+        throw exNormalizer("Unable to write output normalization file.");
+    this->Journal.clear();
+    TargomanLogInfo(5, QString("%1 learned normalization rules compacted into <%2>").arg(
+                        Rules.size()).arg(this->ConfigFileName));
 }
 
 /**
- * @brief Converts a character to a string (some times hex string) based on input character unicode.
- * @param _char Input character
+ * @brief Converts a code point to a string (some times hex string) based on input code point.
+ * @param _char Input code point
  * @param _hexForced Sould output string necessarily be in hex format or not.
  * @return Returns output string
  */
-QString Normalizer::char2Str(const QChar &_char, bool _hexForced)
+QString Normalizer::char2Str(uint _char, bool _hexForced)
 {
     // it doesn't make hex string if _hexForced is not true and input character is of type latin 1 or number. 'equal (=)' character should always be in hex format.
-    if (!_hexForced && (_char.isLetterOrNumber() || _char.toLatin1() == _char) && _char != '=')
-        return _char;
+    if (!_hexForced && (QChar::isLetterOrNumber(_char) || _char < 0x100) && _char != '=')
+        return codePoint2Str(_char);
     else
-        return QString("<0x%1>").arg(QString::number(_char.unicode(),16).toLatin1().toUpper().constData());
+        return QString("<0x%1>").arg(QString::number(_char,16).toLatin1().toUpper().constData());
 }
 /**
- * @brief converts a single or a range of character string to a list of QChars. characters can be in hex format.
+ * @brief converts a single or a range of character string to a list of code points. characters can be in hex format.
  * @param _str input string
  * @param _line line number
  * @param _allowRange does it accept a range of character or not.
  * @exception throws exception if range conversion is nor allowed, but input string contains a range of characters.
  * @exception throws exception if input string does not contains a valid input pattern.
- * @return Returns a list QChars, extracted from input string.
+ * @exception throws exception if input string contains a value which is not a valid code point.
+ * @return Returns a list of code points, extracted from input string.
  */
-QList<QChar> Normalizer::str2QChar(QString _str, int _line, bool _allowRange)
+QList<uint> Normalizer::str2CodePoints(QString _str, int _line, bool _allowRange)
 {
     thread_local static QRegularExpression RxRange = QRegularExpression("<0[x][0-9a-fA-F]+>-<0[x][0-9a-fA-F]+>");
     thread_local static QRegularExpression RxQChar = QRegularExpression("<0[x][0-9a-fA-F]+>");
 
-    QList<QChar> Chars;
+    QList<uint> Chars;
     if (_str.size() == 1)
-        Chars.append(_str.at(0));
+        Chars.append(_str.at(0).unicode());
+    else if (_str.size() == 2 && _str.at(0).isHighSurrogate() && _str.at(1).isLowSurrogate())
+        Chars.append(QChar::surrogateToUcs4(_str.at(0), _str.at(1)));
     else if (_str.contains(RxRange)){
         if(_allowRange){
             uint RangeStart = _str.split("-").first().replace("<0x","").replace(">","").toUInt(nullptr,16);
             uint RangeEnd = _str.split("-").last().replace("<0x","").replace(">","").toUInt(nullptr,16);
+            if (RangeEnd > QChar::LastValidCodePoint)
+                throw exNormalizer(("Invalid normalization range at line "+ QString::number(_line)+": <" + _str + ">"));
             for (uint i=RangeStart; i<=RangeEnd;i++)
-                Chars.append(QChar(i));
+                Chars.append(i);
         }else
             throw exNormalizer(("Invalid normalization character at line "+ QString::number(_line)+": <" + _str + ">"));
-    }else if (_str.contains(RxQChar))
-        Chars.append(QChar(_str.replace("<0x","").replace(">","").toUInt(nullptr, 16)));
-    else
+    }else if (_str.contains(RxQChar)){
+        uint CodePoint = _str.replace("<0x","").replace(">","").toUInt(nullptr, 16);
+        if (CodePoint > QChar::LastValidCodePoint)
+            throw exNormalizer(("Invalid normalization character at line "+ QString::number(_line)+": <" + _str + ">"));
+        Chars.append(CodePoint);
+    }else
         throw exNormalizer(("Invalid normalization character at line "+ QString::number(_line)+": <" + _str + ">"));
 
     return Chars;
@@ -524,25 +1036,7 @@ void Normalizer::init(const QString &_configFile, bool _binaryMode)
     this->BinaryMode = _binaryMode;
 
     if (_binaryMode){
-        if (QFile::exists(_configFile) == false)
-            throw exNormalizer("TextProcessor Normalization File <" + _configFile + " not found.");
-        QFile BinFile(_configFile);
-        BinFile.open(QFile::ReadOnly);
-        if (!BinFile.isReadable())
-            throw exNormalizer("Unable to open " + _configFile + " for reading");
-
-        TargomanInlineInfo(5, "Reading Normalization Bin File...");
-        QByteArray MD5 = BinFile.read(32);
-
-        QByteArray Buffer = BinFile.readAll();
-        if (QCryptographicHash::hash(Buffer, QCryptographicHash::Md5).toHex() != MD5){
-            TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Corrupted");
-            throw exNormalizer("Seems taht binary table is corrupted");
-        }
-
-        QDataStream Stream(&Buffer, QIODevice::ReadOnly);
-        Stream>>this->BinTable;
-        TargomanFinishInlineInfo(TARGOMAN_COLOR_HAPPY, "Loaded");
+        this->mapBinTable(_configFile);
         return;
     }
     if (QFile::exists(this->ConfigFileName) == false)
@@ -591,8 +1085,8 @@ void Normalizer::init(const QString &_configFile, bool _binaryMode)
         case enuDicType::WhiteList:
             StrList = ConfigLine.split(" ", QString::SkipEmptyParts);
             foreach (const QString& CharStr, StrList){
-                QList<QChar> Chars = this->str2QChar(CharStr, LineNumber);
-                foreach (const QChar& Ch, Chars)
+                QList<uint> Chars = this->str2CodePoints(CharStr, LineNumber);
+                foreach (uint Ch, Chars)
                     this->WhiteList.insert(Ch);
             }
             break;
@@ -601,9 +1095,9 @@ void Normalizer::init(const QString &_configFile, bool _binaryMode)
             QStringList Pair = ConfigLine.split('=');
             if (Pair.size() == 2)
                 this->ReplacingTable.insert(
-                        this->str2QChar(Pair[0].trimmed(), LineNumber, false).first(),
+                        this->str2CodePoints(Pair[0].trimmed(), LineNumber, false).first(),
                     Pair[1].trimmed().size() > 1 && Pair[1].trimmed().startsWith("<") ==false ?
-                        Pair[1].trimmed() : str2QChar(Pair[1].trimmed(), LineNumber, false).first());
+                        Pair[1].trimmed() : codePoint2Str(str2CodePoints(Pair[1].trimmed(), LineNumber, false).first()));
             else {
                 throw exNormalizer(QString("Invalid Word Pair at line: %1 ==> %2").arg(LineNumber).arg(ConfigLine));
             }
@@ -612,24 +1106,24 @@ void Normalizer::init(const QString &_configFile, bool _binaryMode)
         case enuDicType::RemovingCharacters:
             StrList = ConfigLine.split(" ", QString::SkipEmptyParts);
             foreach (const QString& CharStr, StrList){
-                QList<QChar> Chars = this->str2QChar(CharStr, LineNumber);
-                foreach (const QChar& Ch, Chars)
+                QList<uint> Chars = this->str2CodePoints(CharStr, LineNumber);
+                foreach (uint Ch, Chars)
                     this->RemovingList.insert(Ch);
             }
             break;
         case enuDicType::SpaceCharacters:
             StrList = ConfigLine.split(" ", QString::SkipEmptyParts);
             foreach (const QString& CharStr, StrList){
-                QList<QChar> Chars = this->str2QChar(CharStr, LineNumber);
-                foreach (const QChar& Ch, Chars)
+                QList<uint> Chars = this->str2CodePoints(CharStr, LineNumber);
+                foreach (uint Ch, Chars)
                     this->SpaceCharList.insert(Ch);
             }
             break;
         case enuDicType::ZeroWidthSpaceCharacters:
             StrList = ConfigLine.split(" ", QString::SkipEmptyParts);
             foreach (const QString& CharStr, StrList){
-                QList<QChar> Chars = this->str2QChar(CharStr, LineNumber);
-                foreach (const QChar& Ch, Chars)
+                QList<uint> Chars = this->str2CodePoints(CharStr, LineNumber);
+                foreach (uint Ch, Chars)
                     this->ZeroWidthSpaceCharList.insert(Ch);
             }
             break;
@@ -641,16 +1135,23 @@ void Normalizer::init(const QString &_configFile, bool _binaryMode)
     if (!IsEOF)
         throw exNormalizer("Invalid Normalization file as EOF section not found");
 
+    this->replayLearnedRules();
+
     TargomanLogInfo(5,QString("Normalization Table has (%1 WHT/ %2 BLK/ %3 SPC/ %4 ZWNJ/ %5 RPL)").arg(
                         this->WhiteList.size()).arg(
                         this->RemovingList.size ()).arg(
                         this->SpaceCharList.size ()).arg(
                         this->ZeroWidthSpaceCharList.size ()).arg(
                         this->ReplacingTable.size()));
+
+    this->compileActionTable();
+    TargomanLogInfo(5,QString("Normalization action table compiled with %1 pooled characters").arg(
+                        this->table()->ActionPool.size()));
 }
 
 /**
- * @brief Creates binary table. For each character in unicode range, this function finds a normalized form for that and saves normalized form of that in a binary file.
+ * @brief Creates binary table. Compiled action table and its string pool are saved in a versioned binary file
+ * which can be mapped to memory by init() in binary mode.
  * @param _binFilePath Path to save binary table.
  * @param _interactive Can normalization process be done intractively or not.
  * @exception throws exception if this function is called when working in binary mode.
@@ -661,34 +1162,133 @@ void Normalizer::updateBinTable(const QString &_binFilePath, bool _interactive)
     if (this->BinaryMode)
         throw exNormalizer("Unable to update binary file when working in binary mode.");
 
-    QFile BinFile(_binFilePath);
-    BinFile.open(QFile::WriteOnly);
-    if (!BinFile.isWritable())
-        throw exNormalizer("Unable to open " + _binFilePath + " for writing");
-
     TargomanInlineInfo(5, "Creating Map...");
-
-    QList<QVariant> Map;
-    Map.append(SYMBOL_REMOVED);
-    QChar Char;
-    for (int i=1; i<=0xFFFF; i++){
-        Char = QChar(i);
-        Map.append(this->normalize(Char, QChar(),_interactive,-1,"NO_PHRASE",0));
+    if (_interactive){
+        // Normalizing each code point interactively will ask user about unresolved characters and recompile table.
+        QString Scratch;
+        for (uint i=1; i<=QChar::LastValidCodePoint; i++){
+            stuNormalizationContext Context;
+            Scratch.clear();
+            this->normalize(i, 0, Context, Scratch, true, -1, "NO_PHRASE", 0);
+        }
     }
     TargomanFinishInlineInfo(TARGOMAN_COLOR_HAPPY, "Done");
     TargomanInlineInfo(5, "Writing to disk...");
-    QByteArray Buffer;
-    QDataStream OutStream(&Buffer, QIODevice::WriteOnly);
-    OutStream<<Map;
 
-
-    BinFile.write(QCryptographicHash::hash(Buffer, QCryptographicHash::Md5).toHex());
-    BinFile.write(Buffer);
+    ActionTablePtr_t Table = this->table();
+
+    stuBinTableHeader Header;
+    memset(&Header, 0, sizeof(Header));
+    memcpy(Header.Magic, NORMALIZER_BIN_MAGIC, sizeof(Header.Magic));
+    Header.Version = NORMALIZER_BIN_VERSION;
+    Header.ByteOrderMark = 0xFEFF;
+    Header.EntrySize = sizeof(stuNormalizationAction);
+    Header.EntryCount = static_cast<quint32>(Table->ActionTable.size());
+    Header.PoolSize = static_cast<quint32>(Table->ActionPool.size());
+    Header.IndexSize = NORMALIZER_BLOCK_COUNT;
+
+    QByteArray Payload;
+    Payload.append(reinterpret_cast<const char*>(Table->BlockIndexTable.constData()),
+                   static_cast<int>(Header.IndexSize * sizeof(quint16)));
+    Payload.append(reinterpret_cast<const char*>(Table->ActionTable.constData()),
+                   static_cast<int>(Header.EntryCount * sizeof(stuNormalizationAction)));
+    Payload.append(reinterpret_cast<const char*>(Table->ActionPool.constData()),
+                   static_cast<int>(Header.PoolSize * sizeof(QChar)));
+    Header.Checksum = binTableChecksum(reinterpret_cast<const uchar*>(Payload.constData()),
+                                       static_cast<size_t>(Payload.size()));
+
+    // QSaveFile replaces the file atomically so processes which have mapped the old table are not affected.
+    QSaveFile BinFile(_binFilePath);
+    if (!BinFile.open(QFile::WriteOnly))
+        throw exNormalizer("Unable to open " + _binFilePath + " for writing");
+    BinFile.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    BinFile.write(Payload);
+    if (!BinFile.commit())
+        throw exNormalizer("Unable to write binary table to " + _binFilePath);
 
     TargomanFinishInlineInfo(TARGOMAN_COLOR_HAPPY, "Done");
 
     TargomanLogHappy(5, "Normalization binTable written to" + _binFilePath);
 }
+
+/**
+ * @brief Maps a binary table created by updateBinTable() to memory. Table is used directly from mapped pages so
+ * startup does not need any parsing and pages are shared between all processes which map the same file.
+ * @param _binFilePath Path of binary table.
+ * @exception throws exception if it is unable to open or map binary table.
+ * @exception throws exception if binary table is corrupted or has an incompatible version.
+ */
+void Normalizer::mapBinTable(const QString &_binFilePath)
+{
+    if (QFile::exists(_binFilePath) == false)
+        throw exNormalizer("TextProcessor Normalization File <" + _binFilePath + " not found.");
+
+    QScopedPointer<QFile> BinFile(new QFile(_binFilePath));
+    if (!BinFile->open(QFile::ReadOnly))
+        throw exNormalizer("Unable to open " + _binFilePath + " for reading");
+
+    TargomanInlineInfo(5, "Mapping Normalization Bin File...");
+    qint64 FileSize = BinFile->size();
+    if (FileSize < static_cast<qint64>(sizeof(stuBinTableHeader))){
+        TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Corrupted");
+        throw exNormalizer("Seems that binary table is corrupted");
+    }
+
+    const uchar* Mapped = BinFile->map(0, FileSize);
+    if (Mapped == nullptr){
+        TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Failed");
+        throw exNormalizer("Unable to map " + _binFilePath + ": " + BinFile->errorString());
+    }
+
+    const stuBinTableHeader* Header = reinterpret_cast<const stuBinTableHeader*>(Mapped);
+    if (memcmp(Header->Magic, NORMALIZER_BIN_MAGIC, sizeof(Header->Magic)) ||
+        Header->ByteOrderMark != 0xFEFF ||
+        Header->EntrySize != sizeof(stuNormalizationAction)){
+        TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Invalid");
+        throw exNormalizer("Invalid binary table format. Recreate it using updateBinTable");
+    }
+    if (Header->Version != NORMALIZER_BIN_VERSION){
+        TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Invalid");
+        throw exNormalizer(QString("Binary table version %1 is not supported. Recreate it using updateBinTable").arg(
+                               Header->Version));
+    }
+
+    qint64 PayloadSize = static_cast<qint64>(Header->IndexSize) * sizeof(quint16) +
+                         static_cast<qint64>(Header->EntryCount) * sizeof(stuNormalizationAction) +
+                         static_cast<qint64>(Header->PoolSize) * sizeof(QChar);
+    if (Header->IndexSize != NORMALIZER_BLOCK_COUNT ||
+        Header->EntryCount < 0x10000 ||
+        (Header->EntryCount & 0xFF) ||
+        FileSize != static_cast<qint64>(sizeof(stuBinTableHeader)) + PayloadSize ||
+        binTableChecksum(Mapped + sizeof(stuBinTableHeader), static_cast<size_t>(PayloadSize)) != Header->Checksum){
+        TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Corrupted");
+        throw exNormalizer("Seems that binary table is corrupted");
+    }
+
+    const quint16* BlockIndex = reinterpret_cast<const quint16*>(Mapped + sizeof(stuBinTableHeader));
+    const stuNormalizationAction* Actions =
+            reinterpret_cast<const stuNormalizationAction*>(BlockIndex + Header->IndexSize);
+    const QChar* Pool = reinterpret_cast<const QChar*>(Actions + Header->EntryCount);
+    for (quint32 i = 0; i < Header->IndexSize; ++i)
+        if ((i < 0x100 && BlockIndex[i] != i) || BlockIndex[i] >= (Header->EntryCount >> 8)){
+            TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Corrupted");
+            throw exNormalizer("Seems that binary table is corrupted");
+        }
+    for (quint32 i = 0; i < Header->EntryCount; ++i)
+        if (static_cast<quint64>(Actions[i].Offset) + Actions[i].Length > Header->PoolSize){
+            TargomanFinishInlineInfo(TARGOMAN_COLOR_ERROR, "Corrupted");
+            throw exNormalizer("Seems that binary table is corrupted");
+        }
+
+    std::shared_ptr<stuActionTable> NewTable(new stuActionTable);
+    NewTable->Actions = Actions;
+    NewTable->Pool = Pool;
+    NewTable->BlockIndex = BlockIndex;
+    NewTable->MappedBinFile.swap(BinFile);
+    prepareNormalScanner(*NewTable);
+    std::atomic_store(&this->Table, ActionTablePtr_t(NewTable));
+    TargomanFinishInlineInfo(TARGOMAN_COLOR_HAPPY, "Mapped");
+}
 /**
  * @brief Remove extra non-breaking space after non-joinable characters and before space and trims out side spaces and ZWNJs.
  * @param _str input string.
@@ -699,22 +1299,7 @@ QString Normalizer::fullTrim(const QString &_str)
     QString Normalized;
     QString trimmedString = _str.trimmed();
     for (int i=0; i<trimmedString.size(); i++){
-        //
-        if (trimmedString.at(i) == ARABIC_ZWNJ && ((i>0 &&(
-                                              trimmedString.at(i-1).joining() == QChar::Right ||
-                                              trimmedString.at(i-1).joining() == QChar::OtherJoining ||
-                                              trimmedString.at(i-1).isSpace() ||
-                                              trimmedString.at(i-1).isSymbol() ||
-                                              trimmedString.at(i-1).isDigit()||
-                                              trimmedString.at(i-1).isPunct()))
-                                          ||  i == 0
-                                          ||  i == trimmedString.size() - 1
-                                          || (i+1 < trimmedString.size() &&(
-                                                  trimmedString.at(i+1).isSpace() ||
-                                                  trimmedString.at(i+1).isSymbol() ||
-                                                  trimmedString.at(i+1).isDigit() ||
-                                                  trimmedString.at(i+1).isPunct() ||
-                                                  trimmedString.at(i+1).isNull()))))
+        if (isExtraZWNJ(trimmedString, i))
             continue;
         else
             Normalized+=trimmedString.at(i);
@@ -722,6 +1307,30 @@ QString Normalizer::fullTrim(const QString &_str)
     return Normalized;
 }
 
+/**
+ * @brief checks whether character at _pos is a ZWNJ which is removed by fullTrim().
+ * @param _str a trimmed string.
+ */
+bool Normalizer::isExtraZWNJ(const QString &_str, int _pos)
+{
+    int i = _pos;
+    return _str.at(i) == ARABIC_ZWNJ && ((i>0 &&(
+                                              _str.at(i-1).joining() == QChar::Right ||
+                                              _str.at(i-1).joining() == QChar::OtherJoining ||
+                                              _str.at(i-1).isSpace() ||
+                                              _str.at(i-1).isSymbol() ||
+                                              _str.at(i-1).isDigit()||
+                                              _str.at(i-1).isPunct()))
+                                          ||  i == 0
+                                          ||  i == _str.size() - 1
+                                          || (i+1 < _str.size() &&(
+                                                  _str.at(i+1).isSpace() ||
+                                                  _str.at(i+1).isSymbol() ||
+                                                  _str.at(i+1).isDigit() ||
+                                                  _str.at(i+1).isPunct() ||
+                                                  _str.at(i+1).isNull())));
+}
+
 }
 }
 }
@@ -31,8 +31,16 @@
 #include <QSet>
 #include <QStringList>
 #include <QVariant>
+#include <QVector>
+#include <QMutex>
+#include <QFile>
+#include <QScopedPointer>
+#include <memory>
 
 #include "../TextProcessor.h"
+#include "CharScanner.h"
+#include "LearnedRulesJournal.h"
+#include "SourceMap.h"
 
 namespace Targoman {
 namespace NLPLibs {
@@ -61,31 +69,154 @@ TARGOMAN_DEFINE_ENHANCED_ENUM(enuDicType,
 #define MULTI_DOT       QStringLiteral("…")
 #define SYMBOL_REMOVED  QChar(0x2205)
 
+TARGOMAN_DEFINE_ENHANCED_ENUM(enuNormalizationAction,
+                              Emit,
+                              EmitKeepContext,
+                              RedirectToZWNJ,
+                              Recheck
+                              );
+
+/**
+ * @brief Precompiled normalization action of a single character.
+ *
+ * Normalized form of the character is stored in a shared string pool and addressed by Offset and Length. All
+ * context-free rules (white list, removing list, replacing table, unicode categories and script based normalizers)
+ * are resolved when the table is compiled so only context sensitive rules are evaluated on each call.
+ */
+struct stuNormalizationAction{
+    enum enuFlag{
+        ContextSensitive = 0x01,                        /** < Context sensitive rules must be checked before using this action.*/
+        ScriptStage      = 0x02,                        /** < Character is accepted as is when normalized in recheck mode.*/
+        Unresolved       = 0x04,                        /** < No rule resolves this character so it can be defined interactively.*/
+        Identity         = 0x08                         /** < Normalized form is the character itself. String pool is not used.*/
+    };
+
+    quint8  Action;                                     /** < One of enuNormalizationAction values.*/
+    quint8  Flags;                                      /** < Combination of enuFlag values.*/
+    quint16 Length;                                     /** < Length of normalized form in string pool.*/
+    quint32 Offset;                                     /** < Offset of normalized form in string pool.*/
+};
+
+/**
+ * @brief Holds state which is carried from one character to the next one while normalizing a phrase.
+ *
+ * Context sensitive rules (ZWNJ, tatweel, hamza, thousand separators, ...) depend on the last emitted character.
+ * This state is owned by the caller and passed through each call so that a single initialized Normalizer
+ * can be used by many threads at the same time.
+ */
+struct stuNormalizationContext{
+    uint LastCodePoint = 0;                             /** < Last code point in normalization process.*/
+};
+
+#define NORMALIZER_BLOCK_COUNT  ((QChar::LastValidCodePoint + 1) >> 8)
+
+/**
+ * @brief A compiled action table with its string pool and the scanner of characters which are normalized to
+ * themselves.
+ *
+ * Tables are not modified once they are published. Interactive decisions publish a patched copy and calls which have
+ * already taken previous table keep it alive until they finish.
+ */
+struct stuActionTable{
+    QVector<stuNormalizationAction> ActionTable;        /** < Precompiled actions. BMP blocks come first in order followed by shared supplementary blocks.*/
+    QVector<quint16>        BlockIndexTable;            /** < Index of block in ActionTable for each 256 code point block of unicode.*/
+    QString                 ActionPool;                 /** < String pool which holds normalized forms referenced by ActionTable.*/
+    const stuNormalizationAction* Actions = nullptr;    /** < Action table in use. Points to ActionTable or to mapped binary table.*/
+    const QChar*            Pool = nullptr;             /** < String pool in use. Points to ActionPool or to mapped binary table.*/
+    const quint16*          BlockIndex = nullptr;       /** < Block index in use. Points to BlockIndexTable or to mapped binary table.*/
+    QScopedPointer<QFile>   MappedBinFile;              /** < Binary table file which is mapped in binary mode.*/
+    CharScanner             NormalScanner;              /** < Finds runs of characters which are normalized to themselves.*/
+
+    /**
+     * @brief returns action of a code point. BMP code points are looked up directly and others through block index.
+     */
+    inline const stuNormalizationAction& action(uint _codePoint) const{
+        if (Q_LIKELY(_codePoint < 0x10000))
+            return this->Actions[_codePoint];
+        Q_ASSERT(_codePoint <= QChar::LastValidCodePoint);
+        return this->Actions[(static_cast<uint>(this->BlockIndex[_codePoint >> 8]) << 8) | (_codePoint & 0xFF)];
+    }
+};
+
+/**
+ * @brief The Normalizer class normalizes input characters based on rules loaded from normalization config file.
+ *
+ * After init() the normalizer is read-only and normalize() methods can be called concurrently as long as each
+ * caller uses its own stuNormalizationContext. Interactive sessions are serialized internally. Each decision patches
+ * actions of affected code points in a copy of action table which replaces current one at once, so concurrent
+ * non-interactive calls keep using the table they have started with.
+ */
 class Normalizer
 {
 public:
+    Normalizer();
     void init(const QString& _configFile, bool _binaryMode = false);
-    /**
-     * @brief Makes an instance of Normalizer class if it is not instantiated. If it is instantiated, returns that instance.
-     */
-    static Normalizer& instance(){
-        static Normalizer*      Instance = NULL;
-        return *(Q_LIKELY(Instance) ? Instance : (Instance = new Normalizer));
-    }
 
-    QString normalize(const QChar& _char,
-                      const QChar& _nextChar,
-                      bool _interactive,
-                      quint32 _line,
-                      const QString& _phrase,
-                      size_t _charPos,
-                      bool _skipRecheck = false);
+    void normalize(uint _codePoint,
+                   uint _nextCodePoint,
+                   INOUT stuNormalizationContext& _context,
+                   INOUT QString& _output,
+                   bool _interactive,
+                   quint32 _line,
+                   const QString& _phrase,
+                   size_t _charPos,
+                   bool _skipRecheck = false);
+
+    void normalize(const QChar* _data,
+                   int _size,
+                   INOUT stuNormalizationContext& _context,
+                   INOUT QString& _output,
+                   bool _interactive = false,
+                   qint32 _line = -1,
+                   SourceMap* _map = nullptr);
 
     QString normalize(const QString& _string, qint32 _line = -1, bool _interactive = false);
 
     void updateBinTable(const QString& _binFilePath, bool _interactive = false);
+    void compactLearnedRules();
 
     static QString fullTrim(const QString& _str);
+    static bool isExtraZWNJ(const QString& _str, int _pos);
+
+    /**
+     * @brief returns code point which starts at _pos of input buffer. Unpaired surrogates are returned as is.
+     */
+    static inline uint codePointAt(const QChar* _data, int _size, int _pos){
+        if (_data[_pos].isHighSurrogate() && _pos + 1 < _size && _data[_pos + 1].isLowSurrogate())
+            return QChar::surrogateToUcs4(_data[_pos], _data[_pos + 1]);
+        return _data[_pos].unicode();
+    }
+
+    /**
+     * @brief returns code point which ends at end of input buffer.
+     */
+    static inline uint lastCodePoint(const QChar* _data, int _size){
+        if (_size > 1 && _data[_size - 1].isLowSurrogate() && _data[_size - 2].isHighSurrogate())
+            return QChar::surrogateToUcs4(_data[_size - 2], _data[_size - 1]);
+        return _data[_size - 1].unicode();
+    }
+
+    /**
+     * @brief converts a code point to its UTF-16 representation.
+     */
+    static inline QString codePoint2Str(uint _codePoint){
+        if (QChar::requiresSurrogates(_codePoint)){
+            const QChar Pair[2] = {QChar(QChar::highSurrogate(_codePoint)), QChar(QChar::lowSurrogate(_codePoint))};
+            return QString(Pair, 2);
+        }
+        return QChar(_codePoint);
+    }
+
+    /**
+     * @brief appends UTF-16 representation of a code point to output buffer.
+     */
+    static inline void appendCodePoint(INOUT QString& _output, uint _codePoint){
+        if (QChar::requiresSurrogates(_codePoint)){
+            _output.append(QChar(QChar::highSurrogate(_codePoint)));
+            _output.append(QChar(QChar::lowSurrogate(_codePoint)));
+        }else
+            _output.append(QChar(_codePoint));
+    }
     /**
      * @brief removes spaces and zero width non joiners from both sides of input string.
      * @param input string
@@ -103,23 +234,73 @@ public:
 
 
 private:
-    Normalizer();
     Q_DISABLE_COPY(Normalizer)
 
-    void add2Configs(enuDicType::Type _type, QChar _originalChar, QChar _replacement = QChar());
-    QString char2Str(const QChar &_char, bool _hexForced = false);
-    QList<QChar> str2QChar(QString _str, int _line, bool _allowRange = true);
+    typedef std::shared_ptr<const stuActionTable> ActionTablePtr_t;
+
+    /**
+     * @brief returns action table in use.
+     */
+    inline ActionTablePtr_t table() const{
+        return std::atomic_load(&this->Table);
+    }
+
+    void normalize(const stuActionTable& _table,
+                   uint _codePoint,
+                   uint _nextCodePoint,
+                   INOUT stuNormalizationContext& _context,
+                   INOUT QString& _output,
+                   bool _interactive,
+                   quint32 _line,
+                   const QString& _phrase,
+                   size_t _charPos,
+                   bool _skipRecheck = false);
+    bool normalizeByContext(const stuActionTable& _table,
+                            uint _codePoint,
+                            uint _nextCodePoint,
+                            INOUT stuNormalizationContext& _context,
+                            quint32 _line,
+                            const QString& _phrase,
+                            size_t _charPos,
+                            INOUT QString& _output);
+    void normalizeInteractively(uint _codePoint,
+                                uint _nextCodePoint,
+                                INOUT stuNormalizationContext& _context,
+                                quint32 _line,
+                                const QString& _phrase,
+                                size_t _charPos,
+                                INOUT QString& _output);
+    enuNormalizationAction::Type resolveCharacter(uint _codePoint,
+                                                  bool _skipRecheck,
+                                                  INOUT quint8& _flags,
+                                                  INOUT QString& _normalized) const;
+    stuNormalizationAction compileAction(uint _codePoint,
+                                         INOUT QString& _pool,
+                                         INOUT QHash<QString, quint32>& _poolIndex,
+                                         QMultiHash<uint, uint>* _dependents = nullptr) const;
+    void compileActionTable();
+    void patchActionTable(uint _codePoint);
+    void mapBinTable(const QString& _binFilePath);
+    static void prepareNormalScanner(stuActionTable& _table);
+
+    void add2Configs(enuDicType::Type _type, uint _originalChar, uint _replacement = 0);
+    void replayLearnedRules();
+    QString learnedRuleLine(enuDicType::Type _type, uint _originalChar, uint _replacement);
+    QString char2Str(uint _char, bool _hexForced = false);
+    QList<uint> str2CodePoints(QString _str, int _line, bool _allowRange = true);
 
 private:
-    QHash<QChar,QString>    ReplacingTable;             /** < A Map to contain chars that should be replaced. Content of this variable will be added using Normalization config file. */
-    QList<QVariant>         BinTable;                   /** < A List that has normalize form of all character. Index of normal form of each character in this list, is its unicode value.*/
-    QSet<QChar>             WhiteList;                  /** < A Set to contain valid chars. Content of this variable will be added using Normalization config file. */
-    QSet<QChar>             RemovingList;               /** < A Set to contain invalid chars. Content of this variable will be added using Normalization config file. */
-    QSet<QChar>             SpaceCharList;              /** < A Set to contain all kind of spaces chars. Content of this variable will be added using Normalization config file. */
-    QSet<QChar>             ZeroWidthSpaceCharList;     /** < A Set to contain all kind of zero width spaces chars. Content of this variable will be added using Normalization config file. */
+    QHash<uint,QString>     ReplacingTable;             /** < A Map to contain chars that should be replaced. Content of this variable will be added using Normalization config file. */
+    ActionTablePtr_t        Table;                      /** < Action table in use. Must only be accessed by std::atomic_load/atomic_store.*/
+    QMultiHash<uint, uint>  Dependents;                 /** < Code points whose compiled action depends on rules of each code point.*/
+    QSet<uint>              WhiteList;                  /** < A Set to contain valid chars. Content of this variable will be added using Normalization config file. */
+    QSet<uint>              RemovingList;               /** < A Set to contain invalid chars. Content of this variable will be added using Normalization config file. */
+    QSet<uint>              SpaceCharList;              /** < A Set to contain all kind of spaces chars. Content of this variable will be added using Normalization config file. */
+    QSet<uint>              ZeroWidthSpaceCharList;     /** < A Set to contain all kind of zero width spaces chars. Content of this variable will be added using Normalization config file. */
     QString                 ConfigFileName;                 /** < Configuration file address */
     bool                    BinaryMode;                 /** < If Normalization data is in binary mode this variable will be true.*/
-    QChar                   LastChar;                   /** < Last character in normalization process.*/
+    QMutex                  InteractiveLock;            /** < Serializes interactive sessions which modify normalization tables and journal.*/
+    LearnedRulesJournal     Journal;                    /** < Rules learned interactively which are not yet compacted into config file.*/
 };
 
 }
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "PipelineStats.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+PipelineStats::PipelineStats() :
+    Active(false)
+{
+    for (stuCounters& Counters : this->Counters){
+        Counters.Calls.store(0);
+        Counters.Skipped.store(0);
+        Counters.Matches.store(0);
+        Counters.ElapsedNS.store(0);
+    }
+}
+
+/**
+ * @brief returns id of a stage by its name. Stages are registered on first call.
+ * @return id of stage or -1 if there is no room for more stages, in which case stage is not profiled.
+ */
+int PipelineStats::registerStage(const QString &_name)
+{
+    QMutexLocker Locker(&this->NamesLock);
+    int StageID = this->Names.indexOf(_name);
+    if (StageID >= 0)
+        return StageID;
+    if (this->Names.size() >= PIPELINE_STATS_MAX_STAGES){
+        TargomanLogWarn(5, "Pipeline stage " + _name + " will not be profiled as there are too many stages");
+        return -1;
+    }
+    this->Names.append(_name);
+    return this->Names.size() - 1;
+}
+
+/**
+ * @brief returns counters of all stages in order of their registration which is their order in pipeline.
+ * @param _reset if true, counters are reset after being reported.
+ */
+QList<stuPipelineStageStats> PipelineStats::stats(bool _reset)
+{
+    QList<stuPipelineStageStats> Stats;
+    QMutexLocker Locker(&this->NamesLock);
+    for (int StageID = 0; StageID < this->Names.size(); ++StageID){
+        stuCounters& Counters = this->Counters[StageID];
+        stuPipelineStageStats Stage;
+        Stage.Name = this->Names.at(StageID);
+        if (_reset){
+            Stage.Calls = Counters.Calls.exchange(0, std::memory_order_relaxed);
+            Stage.Skipped = Counters.Skipped.exchange(0, std::memory_order_relaxed);
+            Stage.Matches = Counters.Matches.exchange(0, std::memory_order_relaxed);
+            Stage.ElapsedNS = Counters.ElapsedNS.exchange(0, std::memory_order_relaxed);
+        }else{
+            Stage.Calls = Counters.Calls.load(std::memory_order_relaxed);
+            Stage.Skipped = Counters.Skipped.load(std::memory_order_relaxed);
+            Stage.Matches = Counters.Matches.load(std::memory_order_relaxed);
+            Stage.ElapsedNS = Counters.ElapsedNS.load(std::memory_order_relaxed);
+        }
+        Stats.append(Stage);
+    }
+    return Stats;
+}
+
+}
+}
+}
+}
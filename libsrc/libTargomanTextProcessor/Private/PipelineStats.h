@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_PIPELINESTATS_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_PIPELINESTATS_H
+
+#include <atomic>
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QStringList>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+#define PIPELINE_STATS_MAX_STAGES 64
+
+/**
+ * @brief The PipelineStats class accumulates time and number of matches of each stage of text2IXML pipeline.
+ *
+ * Stages are registered by name when they are compiled, so stages of reloaded rules keep accumulating on the same
+ * counters. Counters are atomic and recording takes no lock. Nothing is recorded unless profiling is active.
+ */
+class PipelineStats
+{
+public:
+    static PipelineStats& instance(){
+        // Initialization of a local static is thread safe. Registry is never destroyed as stages may be recorded from any
+        // caller thread, including destructors of thread_local objects which run during process exit
+        static PipelineStats* Instance = new PipelineStats;
+        return *Instance;
+    }
+
+    inline bool isActive() const {return this->Active.load(std::memory_order_relaxed);}
+    inline void setActive(bool _active) {this->Active.store(_active, std::memory_order_relaxed);}
+
+    int registerStage(const QString& _name);
+    inline void record(int _stageID, qint64 _elapsedNS, quint64 _matches){
+        if (_stageID < 0)
+            return;
+        stuCounters& Counters = this->Counters[_stageID];
+        Counters.Calls.fetch_add(1, std::memory_order_relaxed);
+        Counters.Matches.fetch_add(_matches, std::memory_order_relaxed);
+        Counters.ElapsedNS.fetch_add(static_cast<quint64>(_elapsedNS), std::memory_order_relaxed);
+    }
+    inline void recordSkip(int _stageID){
+        if (_stageID >= 0 && this->isActive())
+            this->Counters[_stageID].Skipped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    QList<stuPipelineStageStats> stats(bool _reset = false);
+
+private:
+    struct stuCounters{
+        std::atomic<quint64> Calls;
+        std::atomic<quint64> Skipped;                   /** < Phrases which did not need this stage.*/
+        std::atomic<quint64> Matches;
+        std::atomic<quint64> ElapsedNS;
+    };
+
+private:
+    PipelineStats();
+    Q_DISABLE_COPY(PipelineStats)
+
+private:
+    std::atomic<bool>   Active;
+    QStringList         Names;                          /** < Name of each registered stage, index is id of stage.*/
+    QMutex              NamesLock;
+    stuCounters         Counters[PIPELINE_STATS_MAX_STAGES];
+};
+
+/**
+ * @brief Measures a single run of a stage. Timer is only started when profiling is active.
+ */
+class StageTimer
+{
+public:
+    inline StageTimer(int _stageID) :
+        StageID(_stageID),
+        Active(PipelineStats::instance().isActive()){
+        if (this->Active)
+            this->Timer.start();
+    }
+    inline void finish(quint64 _matches = 0){
+        if (this->Active)
+            PipelineStats::instance().record(this->StageID, this->Timer.nsecsElapsed(), _matches);
+    }
+
+private:
+    int             StageID;
+    bool            Active;
+    QElapsedTimer   Timer;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_PIPELINESTATS_H
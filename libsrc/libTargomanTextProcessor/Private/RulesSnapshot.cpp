@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <atomic>
+#include "RulesSnapshot.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+static RulesSnapshot::Ptr_t    PublishedSnapshot;          /**< Must only be accessed by std::atomic_load/atomic_store.*/
+static std::atomic<quint64>    PublishedVersion(0);        /**< Version of PublishedSnapshot, 0 means nothing is published.*/
+
+RulesSnapshot::RulesSnapshot() :
+    SpellCorrectorInstance(NormalizerInstance),
+    IXMLWriterInstance(NormalizerInstance, SpellCorrectorInstance),
+    Version(0)
+{}
+
+/**
+ * @brief Builds a new snapshot by loading all rule files. Snapshot will not be visible until it is published.
+ * @exception throws exception if any of rule files can not be loaded.
+ */
+RulesSnapshot::Ptr_t RulesSnapshot::load(const TargomanTextProcessor::stuConfigs &_configs)
+{
+    Ptr_t Snapshot(new RulesSnapshot);
+    Snapshot->NormalizerInstance.init(_configs.NormalizationFile);
+    Snapshot->SpellCorrectorInstance.init(_configs.SpellCorrectorBaseConfigPath, _configs.SpellCorrectorLanguageBasedConfigs);
+    Snapshot->IXMLWriterInstance.init(_configs.AbbreviationsFile);
+    return Snapshot;
+}
+
+/**
+ * @brief returns last published snapshot or nullptr if nothing has been published yet.
+ *
+ * In steady state this costs one atomic load and a reference count increment; shared snapshot pointer is only read
+ * when a new version has been published since last call on this thread. A replaced snapshot which is cached by an
+ * idle thread is released on next call of that thread.
+ */
+RulesSnapshot::Ptr_t RulesSnapshot::current()
+{
+    thread_local Ptr_t   CachedSnapshot;
+    thread_local quint64 CachedVersion = 0;
+
+    quint64 Version = PublishedVersion.load(std::memory_order_acquire);
+    if (Q_UNLIKELY(Version != CachedVersion)){
+        CachedSnapshot = std::atomic_load(&PublishedSnapshot);
+        CachedVersion = CachedSnapshot ? CachedSnapshot->Version : 0;
+    }
+    return CachedSnapshot;
+}
+
+/**
+ * @brief Makes a loaded snapshot current. Requests which have already taken previous snapshot will finish on it and
+ * it will be released when last of them finishes. Publishers must be serialized by caller.
+ */
+void RulesSnapshot::publish(const Ptr_t &_snapshot)
+{
+    _snapshot->Version = PublishedVersion.load(std::memory_order_relaxed) + 1;
+    std::atomic_store(&PublishedSnapshot, _snapshot);
+    PublishedVersion.store(_snapshot->Version, std::memory_order_release);
+}
+
+}
+}
+}
+}
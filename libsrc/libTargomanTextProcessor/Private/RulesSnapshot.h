@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_RULESSNAPSHOT_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_RULESSNAPSHOT_H
+
+#include <memory>
+#include "../TextProcessor.h"
+#include "Normalizer.h"
+#include "SpellCorrector.h"
+#include "IXMLWriter.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The RulesSnapshot class holds a complete set of loaded normalization, spell correction and abbreviation
+ * rules.
+ *
+ * Snapshots are built off the hot path and then published at once. Each request takes the current snapshot at its
+ * start and keeps it alive until it finishes, so a reload never changes rules under a running request. Getting the
+ * current snapshot is lock-free: every thread caches the last snapshot it has seen and only refreshes it when the
+ * published version changes.
+ */
+class RulesSnapshot
+{
+public:
+    typedef std::shared_ptr<RulesSnapshot> Ptr_t;
+
+    static Ptr_t load(const TargomanTextProcessor::stuConfigs& _configs);
+    static Ptr_t current();
+    static void publish(const Ptr_t& _snapshot);
+
+    inline Normalizer& normalizer() {return this->NormalizerInstance;}
+    inline SpellCorrector& spellCorrector() {return this->SpellCorrectorInstance;}
+    inline IXMLWriter& ixmlWriter() {return this->IXMLWriterInstance;}
+    inline quint64 version() const {return this->Version;}
+
+private:
+    RulesSnapshot();
+    Q_DISABLE_COPY(RulesSnapshot)
+
+private:
+    Normalizer      NormalizerInstance;             /**< Normalizer which is used by all other members of snapshot.*/
+    SpellCorrector  SpellCorrectorInstance;         /**< Language based spell correctors loaded for this snapshot.*/
+    IXMLWriter      IXMLWriterInstance;             /**< IXML writer using normalizer and spell corrector of this snapshot.*/
+    quint64         Version;                        /**< Version of snapshot. It is assigned when snapshot is published.*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_RULESSNAPSHOT_H
@@ -0,0 +1,327 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "SourceMap.h"
+
+#define TOKEN_ALIGNMENT_MAX_CELLS 1048576 //larger changed windows are aligned as a whole
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief positions of space separated tokens of _text.
+ */
+static QVector<QPair<int, int>> tokenPositions(const QString& _text)
+{
+    QVector<QPair<int, int>> Positions;
+    const QChar* Data = _text.constData();
+    int Size = _text.size();
+    int TokenEnd = 0;
+    for (int TokenStart = 0; TokenStart < Size; TokenStart = TokenEnd){
+        if (Data[TokenStart] == ' '){
+            TokenEnd = TokenStart + 1;
+            continue;
+        }
+        for (TokenEnd = TokenStart + 1; TokenEnd < Size && Data[TokenEnd] != ' '; ++TokenEnd);
+        Positions.append(qMakePair(TokenStart, TokenEnd - TokenStart));
+    }
+    return Positions;
+}
+
+/**
+ * @brief extends _span so that it covers _other too. Spans which are not produced from source are ignored.
+ */
+static inline void unite(stuSourceSpan& _span, const stuSourceSpan& _other)
+{
+    if (_other.Begin < 0)
+        return;
+    if (_span.Begin < 0 || _other.Begin < _span.Begin)
+        _span.Begin = _other.Begin;
+    if (_other.End > _span.End)
+        _span.End = _other.End;
+}
+
+/**
+ * @brief returns union of spans of _count characters starting at _from.
+ */
+stuSourceSpan SourceMap::span(int _from, int _count) const
+{
+    stuSourceSpan Span;
+    for (int i = _from; i < _from + _count; ++i)
+        unite(Span, this->Spans.at(i));
+    return Span;
+}
+
+/**
+ * @brief Replaces all occurrences of _before with _after the same way as QString::replace() does.
+ */
+void SourceMap::replace(QString &_text, const QString &_before, const QString &_after, SourceMap *_map)
+{
+    if (_map == nullptr || _before.isEmpty()){
+        _text.replace(_before, _after);
+        return;
+    }
+
+    int Pos = _text.indexOf(_before);
+    if (Pos < 0)
+        return;
+
+    QString Text;
+    SourceMap Map;
+    Text.reserve(_text.size());
+    Map.reserve(_text.size());
+    int Last = 0;
+    do{
+        Text.append(_text.constData() + Last, Pos - Last);
+        Map.appendCopy(*_map, Last, Pos - Last);
+        Text.append(_after);
+        Map.append(_map->span(Pos, _before.size()), _after.size());
+        Last = Pos + _before.size();
+        Pos = _text.indexOf(_before, Last);
+    }while(Pos >= 0);
+    Text.append(_text.constData() + Last, _text.size() - Last);
+    Map.appendCopy(*_map, Last, _text.size() - Last);
+
+    qSwap(_text, Text);
+    qSwap(_map->Spans, Map.Spans);
+}
+
+/**
+ * @brief Replaces all matches of _regex with _after the same way as QString::replace() does. Back references are
+ * interpreted as QString::replace() does and keep spans of captured characters. Other characters of _after map to
+ * part of match which is not captured by back references, or to whole match if there is no such part.
+ */
+void SourceMap::replace(QString &_text, const QRegularExpression &_regex, const QString &_after, SourceMap *_map)
+{
+    if (_map == nullptr || _regex.isValid() == false){
+        _text.replace(_regex, _after);
+        return;
+    }
+
+    QRegularExpressionMatchIterator Iterator = _regex.globalMatch(_text);
+    if (Iterator.hasNext() == false)
+        return;
+
+    struct stuBackReference{
+        int Pos;
+        int Length;
+        int No;
+    };
+    QVector<stuBackReference> BackReferences;
+    int CaptureCount = _regex.captureCount();
+    for (int i = 0; i < _after.size() - 1; ++i){
+        if (_after.at(i) != '\\')
+            continue;
+        int No = _after.at(i + 1).digitValue();
+        if (No <= 0 || No > CaptureCount)
+            continue;
+        stuBackReference BackReference = {i, 2, No};
+        if (i < _after.size() - 2){
+            int SecondDigit = _after.at(i + 2).digitValue();
+            if (SecondDigit != -1 && No * 10 + SecondDigit <= CaptureCount){
+                BackReference.No = No * 10 + SecondDigit;
+                ++BackReference.Length;
+            }
+        }
+        BackReferences.append(BackReference);
+    }
+
+    QString Text;
+    SourceMap Map;
+    Text.reserve(_text.size() + 16);
+    Map.reserve(_text.size() + 16);
+    int Last = 0;
+    while (Iterator.hasNext()){
+        QRegularExpressionMatch Match = Iterator.next();
+        int Start = Match.capturedStart();
+        int End = Match.capturedEnd();
+        Text.append(_text.constData() + Last, Start - Last);
+        Map.appendCopy(*_map, Last, Start - Last);
+
+        // Characters which are not copied from captured groups map to part of match which is not captured
+        stuSourceSpan MatchSpan;
+        for (int i = Start; i < End; ++i){
+            bool IsCaptured = false;
+            foreach (const stuBackReference& BackReference, BackReferences)
+                if (i >= Match.capturedStart(BackReference.No) && i < Match.capturedEnd(BackReference.No)){
+                    IsCaptured = true;
+                    break;
+                }
+            if (IsCaptured == false)
+                unite(MatchSpan, _map->at(i));
+        }
+        if (MatchSpan.Begin < 0)
+            MatchSpan = _map->span(Start, End - Start);
+        int Pos = 0;
+        foreach (const stuBackReference& BackReference, BackReferences){
+            Text.append(_after.constData() + Pos, BackReference.Pos - Pos);
+            Map.append(MatchSpan, BackReference.Pos - Pos);
+            int CapturedStart = Match.capturedStart(BackReference.No);
+            if (CapturedStart >= 0){
+                Text.append(_text.constData() + CapturedStart, Match.capturedLength(BackReference.No));
+                Map.appendCopy(*_map, CapturedStart, Match.capturedLength(BackReference.No));
+            }
+            Pos = BackReference.Pos + BackReference.Length;
+        }
+        Text.append(_after.constData() + Pos, _after.size() - Pos);
+        Map.append(MatchSpan, _after.size() - Pos);
+        Last = End;
+    }
+    Text.append(_text.constData() + Last, _text.size() - Last);
+    Map.appendCopy(*_map, Last, _text.size() - Last);
+
+    qSwap(_text, Text);
+    qSwap(_map->Spans, Map.Spans);
+}
+
+/**
+ * @brief Sets _text to _tokens joined by spaces. _tokens must be space separated tokens of _text where some of them
+ * may be rewritten. Rewritten tokens map to span of their original form.
+ */
+void SourceMap::joinTokens(QString &_text, const QStringList &_tokens, SourceMap *_map)
+{
+    if (_map == nullptr){
+        _text = _tokens.join(" ");
+        return;
+    }
+
+    QVector<QPair<int, int>> Positions = tokenPositions(_text);
+    Q_ASSERT(Positions.size() == _tokens.size());
+
+    SourceMap Map;
+    Map.reserve(_text.size());
+    for (int i = 0; i < _tokens.size(); ++i){
+        const QPair<int, int>& Position = Positions.at(i);
+        if (i)
+            Map.append(stuSourceSpan());
+        if (QStringRef(&_text, Position.first, Position.second) == _tokens.at(i))
+            Map.appendCopy(*_map, Position.first, Position.second);
+        else
+            Map.append(_map->span(Position.first, Position.second), _tokens.at(i).size());
+    }
+
+    _text = _tokens.join(" ");
+    qSwap(_map->Spans, Map.Spans);
+}
+
+/**
+ * @brief Aligns tokens of a rewritten text to tokens of its original form. Rewriting is expected to be local so common
+ * prefix and suffix are skipped and remaining tokens are aligned using longest common subsequence. Tokens which are
+ * not kept are aligned to all original tokens between their nearest kept neighbours.
+ * @return range of original tokens for each token of _after.
+ */
+QVector<stuTokenRange> SourceMap::alignTokens(const QStringList &_before, const QStringList &_after)
+{
+    QVector<stuTokenRange> Alignment(_after.size());
+    int Prefix = 0;
+    while (Prefix < _before.size() && Prefix < _after.size() && _before.at(Prefix) == _after.at(Prefix))
+        ++Prefix;
+    int Suffix = 0;
+    while (Suffix < _before.size() - Prefix && Suffix < _after.size() - Prefix &&
+           _before.at(_before.size() - 1 - Suffix) == _after.at(_after.size() - 1 - Suffix))
+        ++Suffix;
+
+    for (int i = 0; i < Prefix; ++i)
+        Alignment[i] = {i, i + 1, false};
+    for (int i = 1; i <= Suffix; ++i)
+        Alignment[_after.size() - i] = {_before.size() - i, _before.size() - i + 1, false};
+
+    int BeforeCount = _before.size() - Prefix - Suffix;
+    int AfterCount = _after.size() - Prefix - Suffix;
+    if (AfterCount == 0)
+        return Alignment;
+    if (BeforeCount == 0 || static_cast<qint64>(BeforeCount) * AfterCount > TOKEN_ALIGNMENT_MAX_CELLS){
+        for (int j = 0; j < AfterCount; ++j)
+            Alignment[Prefix + j] = {Prefix, Prefix + BeforeCount, true};
+        return Alignment;
+    }
+
+    int Width = AfterCount + 1;
+    QVector<int> Common((BeforeCount + 1) * Width, 0);
+    for (int i = BeforeCount - 1; i >= 0; --i)
+        for (int j = AfterCount - 1; j >= 0; --j)
+            Common[i * Width + j] = _before.at(Prefix + i) == _after.at(Prefix + j) ?
+                        Common[(i + 1) * Width + j + 1] + 1 :
+                        qMax(Common[(i + 1) * Width + j], Common[i * Width + j + 1]);
+
+    // Tokens between two kept tokens are aligned to original tokens between them
+    int i = 0, j = 0, GapBefore = 0, GapAfter = 0;
+    auto closeGap = [&](int _beforeEnd, int _afterEnd){
+        for (int k = GapAfter; k < _afterEnd; ++k)
+            Alignment[Prefix + k] = {Prefix + GapBefore, Prefix + _beforeEnd, true};
+    };
+    while (i < BeforeCount && j < AfterCount){
+        if (_before.at(Prefix + i) == _after.at(Prefix + j)){
+            closeGap(i, j);
+            Alignment[Prefix + j] = {Prefix + i, Prefix + i + 1, false};
+            GapBefore = ++i;
+            GapAfter = ++j;
+        }else if (Common[(i + 1) * Width + j] >= Common[i * Width + j + 1])
+            ++i;
+        else
+            ++j;
+    }
+    closeGap(BeforeCount, AfterCount);
+    return Alignment;
+}
+
+/**
+ * @brief Updates map of _before text so that it maps _after text which is a rewritten form of it.
+ * @param _alignment alignment of tokens of _after to tokens of _before as returned by alignTokens().
+ */
+void SourceMap::realignTokens(const QString &_before, const QString &_after, const QVector<stuTokenRange> &_alignment)
+{
+    QVector<QPair<int, int>> BeforePositions = tokenPositions(_before);
+    QVector<QPair<int, int>> AfterPositions = tokenPositions(_after);
+    Q_ASSERT(AfterPositions.size() == _alignment.size());
+
+    SourceMap Map;
+    Map.reserve(_after.size());
+    int Last = 0;
+    for (int j = 0; j < AfterPositions.size(); ++j){
+        const QPair<int, int>& Position = AfterPositions.at(j);
+        const stuTokenRange& Range = _alignment.at(j);
+        Map.append(stuSourceSpan(), Position.first - Last);
+        if (Range.Changed == false){
+            Map.appendCopy(*this, BeforePositions.at(Range.First).first, BeforePositions.at(Range.First).second);
+        }else{
+            stuSourceSpan Span;
+            for (int i = Range.First; i < Range.Last; ++i)
+                unite(Span, this->span(BeforePositions.at(i).first, BeforePositions.at(i).second));
+            Map.append(Span, Position.second);
+        }
+        Last = Position.first + Position.second;
+    }
+    Map.append(stuSourceSpan(), _after.size() - Last);
+    qSwap(this->Spans, Map.Spans);
+}
+
+}
+}
+}
+}
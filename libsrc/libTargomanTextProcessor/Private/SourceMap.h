@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_SOURCEMAP_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_SOURCEMAP_H
+
+#include <QRegularExpression>
+#include <QStringList>
+#include <QVector>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief Span of source text which a character is produced from. Begin is -1 for characters which are inserted by
+ * text processor.
+ */
+struct stuSourceSpan{
+    qint32 Begin;
+    qint32 End;
+
+    stuSourceSpan(qint32 _begin = -1, qint32 _end = -1) :
+        Begin(_begin),
+        End(_end)
+    {}
+};
+
+/**
+ * @brief Range of tokens of a text which a token of its rewritten form is aligned to.
+ */
+struct stuTokenRange{
+    int  First;                                         /** < First aligned token.*/
+    int  Last;                                          /** < One after last aligned token. Equal to First for inserted tokens.*/
+    bool Changed;                                       /** < False if token is kept as is.*/
+};
+
+/**
+ * @brief The SourceMap class holds source span of each character of a text while it is being processed.
+ *
+ * Static helpers apply a rewriting step to the text and, when a map is given, update the map accordingly so that
+ * map and text always have same size. Characters which are produced by a replacement map to the span of matched
+ * text they are replacing.
+ */
+class SourceMap
+{
+public:
+    inline int size() const {return this->Spans.size();}
+    inline void clear() {this->Spans.clear();}
+    inline void reserve(int _size) {this->Spans.reserve(_size);}
+    inline const stuSourceSpan& at(int _pos) const {return this->Spans.at(_pos);}
+
+    inline void append(const stuSourceSpan& _span, int _count = 1){
+        for (int i = 0; i < _count; ++i)
+            this->Spans.append(_span);
+    }
+    inline void appendIdentity(qint32 _begin, int _count){
+        for (int i = 0; i < _count; ++i)
+            this->Spans.append(stuSourceSpan(_begin + i, _begin + i + 1));
+    }
+    inline void appendCopy(const SourceMap& _other, int _from, int _count){
+        this->Spans.append(_other.Spans.mid(_from, _count));
+    }
+
+    stuSourceSpan span(int _from, int _count) const;
+
+    static void replace(INOUT QString& _text, const QString& _before, const QString& _after, SourceMap* _map);
+    static void replace(INOUT QString& _text, const QRegularExpression& _regex, const QString& _after, SourceMap* _map);
+    static void joinTokens(INOUT QString& _text, const QStringList& _tokens, SourceMap* _map);
+    static QVector<stuTokenRange> alignTokens(const QStringList& _before, const QStringList& _after);
+    void realignTokens(const QString& _before, const QString& _after, const QVector<stuTokenRange>& _alignment);
+
+private:
+    QVector<stuSourceSpan> Spans;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_SOURCEMAP_H
@@ -27,10 +27,14 @@
 #include <iostream>
 #include <QTextStream>
 #include <QFile>
+#include <QSaveFile>
+#include <QSharedPointer>
+#include <QSet>
 #include <QStringList>
 #include <QDebug>
 
 #include "SpellCorrector.h"
+#include "UnknownCollector.h"
 
 #define DUAL_SPACE "  "
 
@@ -40,19 +44,45 @@ namespace TargomanTP{
 namespace Private {
 
 /**
- * @brief instructor of this class adds default languages data to the #Processors variable.
+ * @brief returns factories of registered language based spell correctors.
  */
-SpellCorrector::SpellCorrector():
-    refNormalizerInstance(Normalizer::instance())
+static QHash<QString, SpellCorrectorFactory_t>& registeredFactories()
+{
+    static QHash<QString, SpellCorrectorFactory_t> Factories;
+    return Factories;
+}
+
+/**
+ * @brief Registers factory of a language based spell corrector. It must be called before any SpellCorrector is
+ * initialized, which is guaranteed when it is called by a global stuSpellCorrectorRegistrar.
+ */
+void SpellCorrector::registerFactory(const char _code[], SpellCorrectorFactory_t _factory)
+{
+    registeredFactories().insert(_code, _factory);
+}
+
+SpellCorrector::SpellCorrector(Normalizer& _normalizer):
+    refNormalizerInstance(_normalizer)
 {}
 
+SpellCorrector::~SpellCorrector()
+{
+    qDeleteAll(this->Processors);
+}
+
 /**
- * @brief Initializes all languages that are in _settings variable and delete each language from #Processors if it is not active.
+ * @brief Instantiates all registered languages, initializes the ones that are in _settings variable and deletes each
+ * language from #Processors if it is not active.
  * @param _baseConfigPath base config path of all language specific spellCorrectors.
  * @param _settings input HashMap that its key is language name and its value is language specific settings.
  */
 void SpellCorrector::init(const QString& _baseConfigPath, const QHash<QString, QVariantHash>& _settings)
 {
+    qDeleteAll(this->Processors);
+    this->Processors.clear();
+    for (auto Factory = registeredFactories().constBegin(); Factory != registeredFactories().constEnd(); ++Factory)
+        this->Processors.insert(Factory.key(), Factory.value()(this->refNormalizerInstance));
+
     foreach(const QString& Lang, _settings.keys()){
         intfSpellCorrector* SpellCorrector = this->Processors.value(Lang);
         if (SpellCorrector){
@@ -96,6 +126,7 @@ QString SpellCorrector::process(const QString& _lang,
     QString Normalized;
     QStringList Tokens;
     QStringList MultiWordBuffer;
+    bool CollectUnknowns = _interactive == false && UnknownCollector::instance().isActive();
     _changed = false;
 
     //Correct all single words
@@ -109,6 +140,7 @@ QString SpellCorrector::process(const QString& _lang,
             if (Normalized.size())
                 Output += Normalized + " ";
             else if (_interactive && Processor->canBeCheckedInteractive(Token)){
+                QMutexLocker Locker(&this->InteractiveLock);
                 std::cout<<"What to do with: <"<<Token.toUtf8().constData()<<">"<<std::endl;
                 bool ValidSelection=false;
                 while (!ValidSelection)
@@ -138,9 +170,14 @@ QString SpellCorrector::process(const QString& _lang,
                         break;
                     }
                 }
-            }else
+            }else{
+                // Suspicious tokens are collected once per phrase instead of blocking for user input
+                if (CollectUnknowns && Processor->canBeCheckedInteractive(Token))
+                    UnknownCollector::instance().recordToken(_lang, Token, _inputStr);
                 Output += Token + " ";
+            }
         }
+        CollectUnknowns = false;
     }while(Output.trimmed() != Phrase.trimmed());
 
     //Process Phrase, processing all bi-tokens then tri-tokens, so on until there are no more changes
@@ -203,11 +240,10 @@ QString SpellCorrector::process(const QString& _lang,
 }
 
 /**************************************************************************************************/
-intfSpellCorrector::intfSpellCorrector(const char _code[]) :
-    refNormalizerInstance(Normalizer::instance())
+intfSpellCorrector::intfSpellCorrector(Normalizer& _normalizer) :
+    refNormalizerInstance(_normalizer)
 {
     this->Active = true;
-    SpellCorrector::instance().registerProcessor(_code, this);
 }
 
 /**
@@ -227,11 +263,12 @@ intfSpellCorrector::intfSpellCorrector(const char _code[]) :
 bool intfSpellCorrector::init(const QString& _baseConfigPath, const QVariantHash _settings)
 {
     this->Active = _settings.value("Active",true).toBool();
+    this->ConfigPath = _baseConfigPath + "/" + this->Lang;
     TargomanInlineInfo(5, "Loading " << this->Lang << " Config file...");
 
     this->MaxAutoCorrectTokens = 0;
     foreach (const stuConfigType& Config, this->ConfigTypes){ // #ConfigTypes list is already initiallized in constructor of language specific spellCorrectors.
-        QString ConfigFilePath = _baseConfigPath + "/" + this->Lang + "/" + Config.Name + ".tbl";
+        QString ConfigFilePath = this->ConfigPath + "/" + Config.Name + ".tbl";
         if (QFile::exists(ConfigFilePath) == false)
             throw exSpellCorrector("File: <"+ConfigFilePath+"> Not found");
         QFile ConfigFile(ConfigFilePath);
@@ -278,6 +315,8 @@ bool intfSpellCorrector::init(const QString& _baseConfigPath, const QVariantHash
         }
     }
 
+    this->replayLearnedRules();
+
     TargomanFinishInlineInfo(TARGOMAN_COLOR_HAPPY, this->Lang + " Loaded");
     foreach (const stuConfigType& Config, this->ConfigTypes)
         if (Config.IsKeyVal){
@@ -292,6 +331,99 @@ bool intfSpellCorrector::init(const QString& _baseConfigPath, const QVariantHash
     return this->postInit(_settings);
 }
 
+/**
+ * @brief Merges terms of learned rules journal into configuration containers. Terms are normalized the same way as
+ * terms loaded from configuration files.
+ */
+void intfSpellCorrector::replayLearnedRules()
+{
+    this->Journal.setFilePath(this->ConfigPath + "/Learned.journal");
+    foreach (const stuLearnedRule& Rule, this->Journal.replay()){
+        foreach (const stuConfigType& Config, this->ConfigTypes){
+            if (Config.Name != Rule.Section)
+                continue;
+            if (Config.IsKeyVal){
+                QString Key = this->refNormalizerInstance.normalize(Rule.Key.trimmed());
+                Config.KeyValStorage->insert(Key, this->refNormalizerInstance.normalize(Rule.Value.trimmed()));
+                this->MaxAutoCorrectTokens = qMax(this->MaxAutoCorrectTokens,
+                                                  Key.split(" ", QString::SkipEmptyParts).size());
+            }else
+                Config.ListStorage->insert(this->refNormalizerInstance.normalize(Rule.Key.trimmed()));
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Appends terms of learned rules journal to their configuration files and clears the journal.
+ *
+ * All configuration files are written to temporary files first and are only replaced when all of them have been
+ * written. Terms which are already in a configuration file are skipped, so if replacing some of the files fails and
+ * the journal is kept, compacting again does not duplicate terms of files which were replaced.
+ * @exception throws exception if a configuration file can not be written.
+ */
+void intfSpellCorrector::compactLearnedRules()
+{
+    this->Journal.sync();
+    QList<stuLearnedRule> Rules = this->Journal.replay();
+    if (Rules.isEmpty())
+        return;
+
+    QHash<QString, QList<QByteArray> > NewLines;
+    foreach (const stuLearnedRule& Rule, Rules)
+        NewLines[Rule.Section].append((Rule.Value.isEmpty() ?
+                                           "NEW " + Rule.Key :
+                                           "NEW " + Rule.Key + " = " + Rule.Value).toUtf8());
+
+    QList<QSharedPointer<QSaveFile> > ConfigFiles;
+    for (auto Lines = NewLines.constBegin(); Lines != NewLines.constEnd(); ++Lines){
+        QString ConfigFileName = this->ConfigPath + "/" + Lines.key() + ".tbl";
+        QByteArray Content;
+        QFile ConfigFileIn(ConfigFileName);
+        if (ConfigFileIn.exists()){
+            if (!ConfigFileIn.open(QIODevice::ReadOnly))
+                throw exSpellCorrector("Unable to read: <" + ConfigFileName + ">");
+            Content = ConfigFileIn.readAll();
+            if (Content.size() && Content.endsWith('\n') == false)
+                Content.append('\n');
+        }
+
+        QSet<QByteArray> ExistingLines;
+        foreach (const QByteArray& Line, Content.split('\n'))
+            ExistingLines.insert(Line.trimmed());
+        bool Changed = false;
+        foreach (const QByteArray& Line, Lines.value()){
+            if (ExistingLines.contains(Line))
+                continue;
+            ExistingLines.insert(Line);
+            Content.append(Line + "\n");
+            Changed = true;
+        }
+        if (Changed == false)
+            continue;
+
+        QSharedPointer<QSaveFile> ConfigFileOut(new QSaveFile(ConfigFileName));
+        if (!ConfigFileOut->open(QIODevice::WriteOnly) || ConfigFileOut->write(Content) != Content.size())
+            throw exSpellCorrector("Unable to write learned terms to: <" + ConfigFileName + ">");
+        ConfigFiles.append(ConfigFileOut);
+    }
+
+    foreach (const QSharedPointer<QSaveFile>& ConfigFile, ConfigFiles)
+        if (!ConfigFile->commit())
+            throw exSpellCorrector("Unable to write learned terms to: <" + ConfigFile->fileName() + ">");
+    this->Journal.clear();
+}
+
+/**
+ * @brief Folds terms learned by all language based spell correctors into their configuration files.
+ */
+void SpellCorrector::compactLearnedRules()
+{
+    QMutexLocker Locker(&this->InteractiveLock);
+    foreach (intfSpellCorrector* Processor, this->Processors)
+        Processor->compactLearnedRules();
+}
+
 }
 }
 }
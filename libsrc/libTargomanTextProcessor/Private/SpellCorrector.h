@@ -29,10 +29,12 @@
 
 #include <QHash>
 #include <QVariantHash>
+#include <QMutex>
 #include "ISO639.h" //From https://github.com/softnhard/ISO639
 
 #include "../TextProcessor.h"
 #include "../Private/Normalizer.h"
+#include "../Private/LearnedRulesJournal.h"
 
 namespace Targoman {
 namespace NLPLibs {
@@ -79,6 +81,7 @@ public:
     inline const QHash<QString, QString>&  autoCorrectTerms(){return this->AutoCorrectTerms;}
     inline int maxAutoCorrectTokens(){return this->MaxAutoCorrectTokens;}
     bool init(const QString &_baseConfigPath, const QVariantHash _settings);
+    void compactLearnedRules();
 
     virtual QString process(const QStringList& _tokens) = 0;
     virtual bool canBeCheckedInteractive(const QString& _inputWord) const = 0;
@@ -102,8 +105,9 @@ public:
     }
 
 protected:
-    intfSpellCorrector(const char _code[2]);
+    intfSpellCorrector(Normalizer& _normalizer);
     virtual bool postInit(const QVariantHash _settings) = 0;
+    void replayLearnedRules();
 
 protected:
     QHash<QString, QString>           AutoCorrectTerms; /**< A list of terms and their correct forms that can be corrected directly.*/
@@ -112,33 +116,48 @@ protected:
     QString AutoCorrectFile;                            /**< Does spell corrector for this language is active or not.  */
     bool Active;                                        /**< Does spell corrector for this language is active or not.  */
     QString Lang;                                       /**< Name of Language.  */
+    QString ConfigPath;                                 /**< Path of language specific configuration files.  */
+    LearnedRulesJournal Journal;                        /**< Terms learned interactively which are not yet compacted into configuration files.  */
 
     Normalizer& refNormalizerInstance;                  /**< An instance of Normalizer class for faster access to normalizer class */
 };
 
+typedef intfSpellCorrector* (*SpellCorrectorFactory_t)(Normalizer& _normalizer);
+
+/**
+ * @brief The SpellCorrector class dispatches spell correction to language based spell correctors.
+ *
+ * Language based spell correctors register a factory once, and each SpellCorrector instantiates its own set of them
+ * on init() so that independent rule sets can be loaded side by side.
+ */
 class SpellCorrector
 {
 public:
-    static SpellCorrector& instance() {
-        static SpellCorrector* Instance = nullptr;
-        return Q_LIKELY(Instance) ? *Instance : *(Instance = new SpellCorrector);
-    }
+    SpellCorrector(Normalizer& _normalizer);
+    ~SpellCorrector();
 
     QString process(const QString& _lang, const QString& _inputStr, INOUT bool& _changed, bool _interactive);
     void init(const QString& _baseConfigPath, const QHash<QString, QVariantHash> &_settings);
+    void compactLearnedRules();
+
+    static void registerFactory(const char _code[2], SpellCorrectorFactory_t _factory);
 
 private:
-    SpellCorrector();
     Q_DISABLE_COPY(SpellCorrector)
-    inline void registerProcessor(const char _code[2], intfSpellCorrector* _instance){
-        this->Processors.insert(_code, _instance);
-    }
 
 private:
     QHash<QString, intfSpellCorrector*> Processors;     /**< A HashMap that key is language name and value is its respective language based spell corrector. */
     Normalizer& refNormalizerInstance;                  /**< An instance of Normalizer class for faster access to normalizer class. */
+    QMutex InteractiveLock;                             /**< Serializes interactive sessions as they modify auto correct terms of language based spell correctors. */
+};
 
-    friend class intfSpellCorrector;
+/**
+ * @brief Registers factory of a language based spell corrector when instantiated as a global variable.
+ */
+struct stuSpellCorrectorRegistrar{
+    stuSpellCorrectorRegistrar(const char _code[2], SpellCorrectorFactory_t _factory){
+        SpellCorrector::registerFactory(_code, _factory);
+    }
 };
 
 }
@@ -34,8 +34,10 @@ namespace TargomanTP{
 namespace Private {
 namespace SpellCorrectors {
 
-//Essential global instance in order to be registered in SpellCorrectors
-static PersianSpellCorrector Instance;
+//Essential global registrar in order to be instantiated by SpellCorrectors
+static stuSpellCorrectorRegistrar Registrar("fa", [](Normalizer& _normalizer) -> intfSpellCorrector* {
+    return new PersianSpellCorrector(_normalizer);
+});
 
 const QString PERSIAN_Mi         = QStringLiteral("می");
 const QString PERSIAN_Nemi       = QStringLiteral("نمی");
@@ -72,8 +74,8 @@ thread_local static  QRegularExpression PERSIAN_RxEndWithAn           = QRegular
 thread_local static  QRegularExpression PERSIAN_RxEndWithPossesive    = QRegularExpression(".*" + PERSIAN_RxPossesive.pattern().mid(0));
 
 
-PersianSpellCorrector::PersianSpellCorrector() :
-    intfSpellCorrector("fa")
+PersianSpellCorrector::PersianSpellCorrector(Normalizer& _normalizer) :
+    intfSpellCorrector(_normalizer)
 {
     this->Lang = "Persian";
     this->ConfigTypes.append(stuConfigType("AutoCorrectTerms",&this->AutoCorrectTerms));
@@ -270,14 +272,14 @@ bool PersianSpellCorrector::canBeCheckedInteractive(const QString &_inputWord) c
 }
 
 /**
- * @brief This function adds new terms to #AutoCorrectTerms variable.
+ * @brief This function adds new terms to #AutoCorrectTerms variable and to learned rules journal.
  * @param _from wrong word that we want to be corrected automatically.
  * @param _to correct word.
  */
 void PersianSpellCorrector::storeAutoCorrectTerm(const QString &_from, const QString &_to)
 {
     this->AutoCorrectTerms.insert(_from, _to);
-    /// @todo save to file
+    this->Journal.append(stuLearnedRule("AutoCorrectTerms", _from, _to));
 }
 
 
@@ -39,7 +39,7 @@ namespace SpellCorrectors {
 class PersianSpellCorrector : public intfSpellCorrector
 {
 public:
-    PersianSpellCorrector();
+    PersianSpellCorrector(Normalizer& _normalizer);
     bool postInit(const QVariantHash _settings);
     QString process(const QStringList& _tokens);
     bool canBeCheckedInteractive(const QString &_inputWord) const;
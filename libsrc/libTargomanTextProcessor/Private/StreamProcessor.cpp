@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "StreamProcessor.h"
+#include "BatchProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+StreamProcessor::StreamProcessor(const std::function<QString (const QString &, quint32)> &_process) :
+    Process(_process),
+    RingSize(BatchProcessor::instance().threadCount() * STREAM_PROCESSOR_LINES_PER_THREAD),
+    Slots(new stuSlot[this->RingSize], [] (stuSlot* _slots) { delete[] _slots; })
+{}
+
+/**
+ * @brief reads UTF-8 lines of _input until its end and writes result of each line followed by a new line to _output.
+ * @return number of lines processed.
+ * @exception rethrows first exception thrown while processing a line, after results of lines before it are written.
+ * Lines after it are dropped. Throws exTextProcessor if output can not be written.
+ */
+quint64 StreamProcessor::run(QIODevice &_input, QIODevice &_output)
+{
+    quint64 Head = 0;                       // index of next line to be written
+    quint64 Tail = 0;                       // index of next line to be read
+    try{
+        forever{
+            QByteArray Data = _input.readLine();
+            if (Data.isEmpty()){
+                if (_input.waitForReadyRead(-1))
+                    continue;
+                break;
+            }
+            int Size = Data.size();
+            if (Data.at(Size - 1) == '\n')
+                --Size;
+            if (Size && Data.at(Size - 1) == '\r')
+                --Size;
+
+            if (Tail - Head == static_cast<quint64>(this->RingSize))
+                this->writeNext(Head, _output, true);
+
+            stuSlot& Slot = this->slot(Tail);
+            Slot.Line = QString::fromUtf8(Data.constData(), Size);
+            Slot.LineNo = static_cast<quint32>(Tail);
+            Slot.Error = nullptr;
+            Slot.Claimed.store(false, std::memory_order_release);
+            ++Tail;
+            SlotsPtr_t Slots = this->Slots;
+            BatchProcessor::instance().start([this, Slots, &Slot] () {
+                // Line may have been processed by calling thread, in which case this may be gone
+                if (claim(Slot))
+                    this->process(Slot);
+            });
+
+            while (Head < Tail && this->writeNext(Head, _output, false));
+        }
+        while (Head < Tail)
+            this->writeNext(Head, _output, true);
+    }catch(...){
+        this->abandon(Head, Tail);
+        throw;
+    }
+    return Tail;
+}
+
+/**
+ * @brief processes a claimed line. Exceptions are kept to be rethrown by calling thread.
+ */
+void StreamProcessor::process(stuSlot &_slot)
+{
+    try{
+        _slot.Line = this->Process(_slot.Line, _slot.LineNo);
+    }catch(...){
+        _slot.Error = std::current_exception();
+    }
+    _slot.Ready.release();
+}
+
+/**
+ * @brief writes result of line at _head and advances _head.
+ * @param _wait if false, returns false instead of waiting when line is not processed yet. Otherwise, line is processed
+ * by calling thread if no worker has taken it.
+ */
+bool StreamProcessor::writeNext(quint64 &_head, QIODevice &_output, bool _wait)
+{
+    stuSlot& Slot = this->slot(_head);
+    if (_wait){
+        if (claim(Slot))
+            this->process(Slot);
+        Slot.Ready.acquire();
+    }else if (Slot.Ready.tryAcquire() == false)
+        return false;
+    ++_head;
+
+    if (Slot.Error)
+        std::rethrow_exception(Slot.Error);
+
+    QByteArray Data = Slot.Line.toUtf8();
+    Data.append('\n');
+    if (_output.write(Data) != Data.size())
+        throw exTextProcessor("Unable to write to output: " + _output.errorString());
+    if (_output.bytesToWrite() > STREAM_PROCESSOR_MAX_PENDING_OUTPUT)
+        _output.waitForBytesWritten(-1);
+    return true;
+}
+
+/**
+ * @brief drops lines in [_head, _tail) and waits for those which are being processed, so that no worker uses this
+ * after run() has returned.
+ */
+void StreamProcessor::abandon(quint64 _head, quint64 _tail)
+{
+    for (quint64 Index = _head; Index < _tail; ++Index){
+        stuSlot& Slot = this->slot(Index);
+        if (claim(Slot) == false)
+            Slot.Ready.acquire();
+    }
+}
+
+}
+}
+}
+}
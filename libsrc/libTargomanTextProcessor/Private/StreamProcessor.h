@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_STREAMPROCESSOR_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_STREAMPROCESSOR_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <QIODevice>
+#include <QSemaphore>
+#include <QSharedPointer>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+#define STREAM_PROCESSOR_LINES_PER_THREAD   64
+#define STREAM_PROCESSOR_MAX_PENDING_OUTPUT (4 * 1024 * 1024)
+
+/**
+ * @brief The StreamProcessor class processes lines of a device on thread pool of BatchProcessor and writes results
+ * to another device in order of input.
+ *
+ * Calling thread reads and writes the devices, so they are never accessed from other threads. Lines are kept in a
+ * ring of fixed size while being processed. When ring is full, reading waits for the oldest line to be written, so
+ * memory used does not depend on size of input. If oldest line has not been taken by any worker yet, calling thread
+ * processes it itself.
+ */
+class StreamProcessor
+{
+public:
+    StreamProcessor(const std::function<QString(const QString& _line, quint32 _lineNo)>& _process);
+    quint64 run(QIODevice& _input, QIODevice& _output);
+
+private:
+    struct stuSlot{
+        QString             Line;                       /** < Input line which is replaced by its result.*/
+        quint32             LineNo;
+        std::exception_ptr  Error;
+        std::atomic<bool>   Claimed;                    /** < Set by whoever processes the line.*/
+        QSemaphore          Ready;                      /** < Released once line is processed.*/
+
+        stuSlot() : LineNo(0), Claimed(true) {}
+    };
+    typedef QSharedPointer<stuSlot> SlotsPtr_t;
+
+private:
+    inline stuSlot& slot(quint64 _index) { return this->Slots.data()[_index % this->RingSize]; }
+    static inline bool claim(stuSlot& _slot) { return _slot.Claimed.exchange(true, std::memory_order_acq_rel) == false; }
+    void process(stuSlot& _slot);
+    bool writeNext(INOUT quint64& _head, QIODevice& _output, bool _wait);
+    void abandon(quint64 _head, quint64 _tail);
+
+private:
+    std::function<QString(const QString&, quint32)> Process;
+    int         RingSize;
+    SlotsPtr_t  Slots;                                  /** < Shared with queued tasks, which may outlive run().*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_STREAMPROCESSOR_H
@@ -0,0 +1,463 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QStringList>
+#include <QVarLengthArray>
+#include <algorithm>
+
+#include "URLMatcher.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+static const QStringList& allowedFarsiDomainNames()
+{
+    static QStringList AllowedFarsiDomainNames = {
+        QStringLiteral("کام"),
+        QStringLiteral("نت"),
+        QStringLiteral("ارگ"),
+        QStringLiteral("آی‌آر")
+    };
+    return AllowedFarsiDomainNames;
+}
+
+static inline bool isDigit(QChar _char){
+    return _char.unicode() >= '0' && _char.unicode() <= '9';
+}
+
+/**
+ * @brief [a-z\u00a1-\uffff0-9] in case insensitive mode. Characters out of BMP are matched as a whole by regular
+ * expressions so their surrogates are not label characters.
+ */
+static inline bool isLabelChar(QChar _char){
+    ushort Char = _char.unicode();
+    if (Char < 0x80)
+        return (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z') || (Char >= '0' && Char <= '9');
+    return Char >= 0xA1 && QChar::isSurrogate(Char) == false;
+}
+
+/**
+ * @brief compares a character with an ASCII character case insensitively. Like regular expressions, Kelvin sign and
+ * long s are also matched by their ASCII case folds.
+ */
+static inline bool sameCaseless(QChar _char, char _ascii){
+    ushort Char = _char.unicode();
+    if (Char < 0x80)
+        return (_ascii >= 'a' && _ascii <= 'z') ? (Char | 0x20) == _ascii : Char == _ascii;
+    return (_ascii == 's' && Char == 0x017F) || (_ascii == 'k' && Char == 0x212A);
+}
+
+static inline bool isTLDLetter(QChar _char){
+    ushort Char = _char.unicode();
+    return ((Char | 0x20) >= 'a' && (Char | 0x20) <= 'z') || Char == 0x017F || Char == 0x212A;
+}
+
+/**
+ * @brief \s of regular expressions which is ASCII only.
+ */
+static inline bool isSpace(QChar _char){
+    ushort Char = _char.unicode();
+    return Char == ' ' || (Char >= '\t' && Char <= '\r');
+}
+
+intfEntityMatcher::intfState *URLMatcher::newState() const
+{
+    return new stuScanCache;
+}
+
+/**
+ * @brief finds first URL or IP in _text starting at or after _from. Candidate positions are filtered using the dot
+ * which must follow first label or octet, so search stops as soon as there is no dot after current position. Dots are
+ * searched forward and each one is found once per text when _state is provided.
+ */
+int URLMatcher::find(const QString &_text, int _from, int &_length, intfState* _state) const
+{
+    const QChar* Data = _text.constData();
+    int Size = _text.size();
+    _from = qMax(0, _from);
+
+    stuScanCache LocalCache;
+    stuScanCache& Cache = _state ? *static_cast<stuScanCache*>(_state) : LocalCache;
+    int RunEnd = _from;
+    for (int Pos = _from; Pos < Size; ++Pos){
+        if (Cache.NextDot < Pos){
+            Cache.NextDot = _text.indexOf('.', Pos);
+            if (Cache.NextDot < 0)
+                Cache.NextDot = Size;
+        }
+        if (Cache.NextDot >= Size)
+            return -1;
+        if (isLabelChar(Data[Pos]) == false)
+            continue;
+        if (Pos >= RunEnd){
+            RunEnd = Pos;
+            while (RunEnd < Size && (isLabelChar(Data[RunEnd]) || Data[RunEnd] == '-'))
+                ++RunEnd;
+        }
+        // Without protocol, first label or octet is a part of a run which ends with a dot
+        if (Data[RunEnd] != '.' && protocolLength(Data, Size, Pos) == 0)
+            continue;
+
+        int End = addressEnd(Data, Size, Pos, false, Cache);
+        if (End >= 0){
+            _length = suffixEnd(Data, Size, End) - Pos;
+            return Pos;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief checks whether the whole token is a URL or an IP.
+ */
+bool URLMatcher::isURL(const QString &_token) const
+{
+    const QChar* Data = _token.constData();
+    int Size = _token.size();
+    // $ also matches before a final new line
+    if (Size && Data[Size - 1] == '\n')
+        --Size;
+    if (Size == 0)
+        return false;
+    // None of URL parts accepts spaces, so suffixes are not checked for spaces afterwards
+    for (int Pos = 0; Pos < Size; ++Pos)
+        if (isSpace(Data[Pos]))
+            return false;
+
+    stuScanCache Cache;
+    return addressEnd(Data, Size, 0, true, Cache) >= 0;
+}
+
+/**
+ * @brief returns length of (?:https?|ftp):// at _pos or 0 if there is no protocol.
+ */
+int URLMatcher::protocolLength(const QChar *_data, int _size, int _pos)
+{
+    static const char* Protocols[] = {"https://", "http://", "ftp://"};
+    for (const char* Protocol : Protocols){
+        int Length = 0;
+        while (Protocol[Length] && _pos + Length < _size && sameCaseless(_data[_pos + Length], Protocol[Length]))
+            ++Length;
+        if (Protocol[Length] == '\0')
+            return Length;
+    }
+    return 0;
+}
+
+/**
+ * @brief matches optional protocol followed by an IP or a domain name at _pos.
+ * @param _wholeText when set, only matches which span to end of text (including port and path) are accepted.
+ * @param _cache labels and domains scanned for previous positions, so that positions on the same label or chain of
+ * labels do not scan them again.
+ * @return end of address without port and path, or -1 if there is no match.
+ */
+int URLMatcher::addressEnd(const QChar *_data, int _size, int _pos, bool _wholeText, stuScanCache &_cache)
+{
+    int Protocol = protocolLength(_data, _size, _pos);
+    // Protocol is optional, so address is also tried without it when it fails after protocol
+    const int Starts[] = {_pos + Protocol, _pos};
+    for (int i = Protocol ? 0 : 1; i < 2; ++i){
+        int Start = Starts[i];
+        if (isExcludedIP(_data, _size, Start) == false){
+            int End = ipv4End(_data, _size, Start, 0, _wholeText);
+            if (End >= 0)
+                return End;
+        }
+        if (Start < _size && isLabelChar(_data[Start])){
+            if (Start < _cache.LabelStart || Start >= _cache.LabelEnd){
+                _cache.LabelStart = Start;
+                _cache.LabelEnd = labelEnd(_data, _size, Start);
+            }
+            int Dot = _cache.LabelEnd;
+            if (Dot < _size && _data[Dot] == '.'){
+                if (_wholeText){
+                    if (hasWholeDomain(_data, _size, Dot))
+                        return _size;
+                }else{
+                    int End = domainEnd(_data, _size, Dot, _cache.DomainEnds);
+                    if (End >= 0)
+                        return End;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief matches octets of an IPv4 address recursively, trying alternatives of each octet in the same order as
+ * (?:[1-9]\d?|1\d\d|2[01]\d|22[0-3])(?:\.(?:1?\d{1,2}|2[0-4]\d|25[0-5])){2}\.(?:[1-9]\d?|1\d\d|2[0-4]\d|25[0-4])
+ * @return end of address or -1 if there is no match.
+ */
+int URLMatcher::ipv4End(const QChar *_data, int _size, int _pos, int _octet, bool _wholeText)
+{
+    int D[3];
+    for (int i = 0; i < 3; ++i)
+        D[i] = (_pos + i < _size && isDigit(_data[_pos + i])) ? _data[_pos + i].unicode() - '0' : -1;
+
+    int Lengths[5];
+    int Count = 0;
+    switch(_octet){
+    case 0:
+        if (D[0] >= 1){ if (D[1] >= 0) Lengths[Count++] = 2; Lengths[Count++] = 1; }
+        if (D[0] == 1 && D[1] >= 0 && D[2] >= 0) Lengths[Count++] = 3;
+        if (D[0] == 2 && (D[1] == 0 || D[1] == 1) && D[2] >= 0) Lengths[Count++] = 3;
+        if (D[0] == 2 && D[1] == 2 && D[2] >= 0 && D[2] <= 3) Lengths[Count++] = 3;
+        break;
+    case 3:
+        if (D[0] >= 1){ if (D[1] >= 0) Lengths[Count++] = 2; Lengths[Count++] = 1; }
+        if (D[0] == 1 && D[1] >= 0 && D[2] >= 0) Lengths[Count++] = 3;
+        if (D[0] == 2 && D[1] >= 0 && D[1] <= 4 && D[2] >= 0) Lengths[Count++] = 3;
+        if (D[0] == 2 && D[1] == 5 && D[2] >= 0 && D[2] <= 4) Lengths[Count++] = 3;
+        break;
+    default:
+        if (D[0] == 1 && D[1] >= 0){ if (D[2] >= 0) Lengths[Count++] = 3; Lengths[Count++] = 2; }
+        if (D[0] >= 0){ if (D[1] >= 0) Lengths[Count++] = 2; Lengths[Count++] = 1; }
+        if (D[0] == 2 && D[1] >= 0 && D[1] <= 4 && D[2] >= 0) Lengths[Count++] = 3;
+        if (D[0] == 2 && D[1] == 5 && D[2] >= 0 && D[2] <= 5) Lengths[Count++] = 3;
+    }
+
+    for (int i = 0; i < Count; ++i){
+        int End = _pos + Lengths[i];
+        if (_octet == 3){
+            if (_wholeText == false || suffixReachesEnd(_data, _size, End))
+                return End;
+        }else if (End < _size && _data[End] == '.'){
+            End = ipv4End(_data, _size, End + 1, _octet + 1, _wholeText);
+            if (End >= 0)
+                return End;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief checks (?=10(?:\.\d{1,3}){3}) which excludes private 10.x.x.x addresses.
+ */
+bool URLMatcher::isExcludedIP(const QChar *_data, int _size, int _pos)
+{
+    if (_pos + 1 >= _size || _data[_pos] != '1' || _data[_pos + 1] != '0')
+        return false;
+    _pos += 2;
+    for (int Group = 0; Group < 3; ++Group){
+        if (_pos >= _size || _data[_pos] != '.')
+            return false;
+        int Digits = 0;
+        for (++_pos; _pos < _size && Digits < 3 && isDigit(_data[_pos]); ++_pos)
+            ++Digits;
+        if (Digits == 0)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief returns end of the longest label at _pos. Labels are runs of label characters joined by single dashes.
+ */
+int URLMatcher::labelEnd(const QChar *_data, int _size, int _pos)
+{
+    forever{
+        while (_pos < _size && isLabelChar(_data[_pos]))
+            ++_pos;
+        if (_pos + 1 < _size && _data[_pos] == '-' && isLabelChar(_data[_pos + 1]))
+            ++_pos;
+        else
+            return _pos;
+    }
+}
+
+/**
+ * @brief walks the chain of labels following _dot and returns end of the deepest top level domain in chain or -1.
+ * Result of each dot in chain is memoized, so each chain is walked once however many positions start on it.
+ */
+int URLMatcher::domainEnd(const QChar *_data, int _size, int _dot, QHash<int, int> &_domainEnds)
+{
+    QVarLengthArray<int, 16> Chain;
+    int Best = -1;
+    forever{
+        auto Known = _domainEnds.constFind(_dot);
+        if (Known != _domainEnds.constEnd()){
+            Best = Known.value();
+            break;
+        }
+        Chain.append(_dot);
+        if (_dot + 1 >= _size || isLabelChar(_data[_dot + 1]) == false)
+            break;
+        _dot = labelEnd(_data, _size, _dot + 1);
+        if (_dot >= _size || _data[_dot] != '.')
+            break;
+    }
+
+    for (int i = Chain.size() - 1; i >= 0; --i){
+        if (Best < 0){
+            int Length = tldLength(_data, _size, Chain.at(i) + 1);
+            if (Length)
+                Best = Chain.at(i) + 1 + Length;
+        }
+        _domainEnds.insert(Chain.at(i), Best);
+    }
+    return Best;
+}
+
+/**
+ * @brief checks whether any top level domain in chain of labels following _dot ends where a port and path can span to
+ * end of text.
+ */
+bool URLMatcher::hasWholeDomain(const QChar *_data, int _size, int _dot)
+{
+    forever{
+        int Pos = _dot + 1;
+        int Letters = 0;
+        while (Pos + Letters < _size && Letters < 4 && isTLDLetter(_data[Pos + Letters]))
+            ++Letters;
+        for (; Letters >= 2; --Letters)
+            if (suffixReachesEnd(_data, _size, Pos + Letters))
+                return true;
+        foreach (const QString& Name, allowedFarsiDomainNames())
+            if (Pos + Name.size() <= _size &&
+                std::equal(Name.constBegin(), Name.constEnd(), _data + Pos) &&
+                suffixReachesEnd(_data, _size, Pos + Name.size()))
+                return true;
+
+        if (Pos >= _size || isLabelChar(_data[Pos]) == false)
+            return false;
+        _dot = labelEnd(_data, _size, Pos);
+        if (_dot >= _size || _data[_dot] != '.')
+            return false;
+    }
+}
+
+/**
+ * @brief returns length of the first top level domain alternative which matches at _pos: [a-z]{2,4} or one of
+ * allowed Farsi domain names. Returns 0 if there is none.
+ */
+int URLMatcher::tldLength(const QChar *_data, int _size, int _pos)
+{
+    int Letters = 0;
+    while (_pos + Letters < _size && Letters < 4 && isTLDLetter(_data[_pos + Letters]))
+        ++Letters;
+    if (Letters >= 2)
+        return Letters;
+    foreach (const QString& Name, allowedFarsiDomainNames())
+        if (_pos + Name.size() <= _size && std::equal(Name.constBegin(), Name.constEnd(), _data + _pos))
+            return Name.size();
+    return 0;
+}
+
+/**
+ * @brief returns end of greedy (?::\d{2,5})?(?:/[^\s]*)? at _pos.
+ */
+int URLMatcher::suffixEnd(const QChar *_data, int _size, int _pos)
+{
+    if (_pos < _size && _data[_pos] == ':'){
+        int Digits = 0;
+        while (_pos + 1 + Digits < _size && Digits < 5 && isDigit(_data[_pos + 1 + Digits]))
+            ++Digits;
+        if (Digits >= 2)
+            _pos += 1 + Digits;
+    }
+    if (_pos < _size && _data[_pos] == '/')
+        do ++_pos; while (_pos < _size && isSpace(_data[_pos]) == false);
+    return _pos;
+}
+
+/**
+ * @brief checks whether (?::\d{2,5})?(?:/[^\s]*)?$ matches at _pos. Text is expected to have no spaces.
+ */
+bool URLMatcher::suffixReachesEnd(const QChar *_data, int _size, int _pos)
+{
+    if (_pos < _size && _data[_pos] == ':'){
+        int Digits = 0;
+        while (_pos + 1 + Digits < _size && isDigit(_data[_pos + 1 + Digits]))
+            ++Digits;
+        if (Digits < 2 || Digits > 5)
+            return false;
+        _pos += 1 + Digits;
+    }
+    return _pos == _size || _data[_pos] == '/';
+}
+
+static inline bool isEmailLocalChar(QChar _char){
+    ushort Char = _char.unicode();
+    return Char < 0x80 && ((Char >= 'a' && Char <= 'z') ||
+                           (Char >= 'A' && Char <= 'Z') ||
+                           (Char >= '0' && Char <= '9') ||
+                           Char == '.' || Char == '_' || Char == '%' || Char == '+' || Char == '-');
+}
+
+static inline bool isEmailDomainChar(QChar _char){
+    ushort Char = _char.unicode();
+    return Char < 0x80 && ((Char >= 'a' && Char <= 'z') ||
+                           (Char >= 'A' && Char <= 'Z') ||
+                           (Char >= '0' && Char <= '9') ||
+                           Char == '.' || Char == '-');
+}
+
+static inline bool isEmailLetter(QChar _char){
+    ushort Char = _char.unicode();
+    return (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z');
+}
+
+/**
+ * @brief finds first e-mail address in _text starting at or after _from. Runs before and after each '@' are disjoint,
+ * so each character is visited a constant number of times.
+ */
+int EmailMatcher::find(const QString &_text, int _from, int &_length, intfState* _state) const
+{
+    Q_UNUSED(_state)
+    const QChar* Data = _text.constData();
+    int Size = _text.size();
+    _from = qMax(0, _from);
+    for (int At = _text.indexOf('@', _from); At >= 0; At = _text.indexOf('@', At + 1)){
+        int Start = At;
+        while (Start > _from && isEmailLocalChar(Data[Start - 1]))
+            --Start;
+        if (Start == At)
+            continue;
+
+        int RunEnd = At + 1;
+        while (RunEnd < Size && isEmailDomainChar(Data[RunEnd]))
+            ++RunEnd;
+        // Domain is at least one character followed by a dot and two letters
+        for (int Dot = RunEnd - 3; Dot > At + 1; --Dot){
+            if (Data[Dot] != '.' || isEmailLetter(Data[Dot + 1]) == false || isEmailLetter(Data[Dot + 2]) == false)
+                continue;
+            int End = Dot + 3;
+            while (End < RunEnd && End < Dot + 5 && isEmailLetter(Data[End]))
+                ++End;
+            _length = End - Start;
+            return Start;
+        }
+    }
+    return -1;
+}
+
+}
+}
+}
+}
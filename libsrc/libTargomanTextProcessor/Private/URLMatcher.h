@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_URLMATCHER_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_URLMATCHER_H
+
+#include <QHash>
+#include <QString>
+
+#include "EntityTagger.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief The URLMatcher class finds URLs and IPv4 addresses in linear time.
+ *
+ * Matching is equivalent to the case insensitive regular expression which was used before:
+ * (?:(?:https?|ftp)://)?(?:(?!10(?:\.\d{1,3}){3})IPv4|Label(?:\.Label)*\.(?:[a-z]{2,4}|FarsiTLD))(?::\d{2,5})?(?:/[^\s]*)?
+ * where Label is (?:[a-z\u00a1-\uffff0-9]+-?)*[a-z\u00a1-\uffff0-9]+. As a label must be followed by a dot, labels
+ * are always maximal runs, so instead of backtracking over nested quantifiers each chain of labels is walked once and
+ * the deepest dot which is followed by a valid top level domain is kept per chain.
+ *
+ * Matcher itself has no state and can be used by all threads. Scanned labels and domains and position of next dot are
+ * kept in state of each search, so that finding all URLs of a text is also linear.
+ */
+class URLMatcher : public intfEntityMatcher
+{
+public:
+    intfState* newState() const;
+    int find(const QString& _text, int _from, INOUT int& _length, intfState* _state) const;
+    bool isURL(const QString& _token) const;
+
+private:
+    struct stuScanCache : public intfState{
+        QHash<int, int> DomainEnds;                     /** < End of deepest top level domain in chain following each dot.*/
+        int LabelStart = -1;                            /** < Last scanned label. Labels starting inside it end with it.*/
+        int LabelEnd = -1;
+        int NextDot = -1;                               /** < First dot at or after last searched position, or size of text.*/
+    };
+
+    static int protocolLength(const QChar* _data, int _size, int _pos);
+    static int addressEnd(const QChar* _data, int _size, int _pos, bool _wholeText, INOUT stuScanCache& _cache);
+    static int ipv4End(const QChar* _data, int _size, int _pos, int _octet, bool _wholeText);
+    static bool isExcludedIP(const QChar* _data, int _size, int _pos);
+    static int labelEnd(const QChar* _data, int _size, int _pos);
+    static int domainEnd(const QChar* _data, int _size, int _dot, INOUT QHash<int, int>& _domainEnds);
+    static bool hasWholeDomain(const QChar* _data, int _size, int _dot);
+    static int tldLength(const QChar* _data, int _size, int _pos);
+    static int suffixEnd(const QChar* _data, int _size, int _pos);
+    static bool suffixReachesEnd(const QChar* _data, int _size, int _pos);
+};
+
+/**
+ * @brief The EmailMatcher class finds e-mail addresses in linear time. Matching is equivalent to
+ * [A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,4}: search is anchored on '@' characters, local part is the run of
+ * allowed characters before it and the domain ends at the last dot of the following run which is followed by two
+ * letters at least.
+ *
+ * Matcher has no state and can be used by all threads.
+ */
+class EmailMatcher : public intfEntityMatcher
+{
+public:
+    int find(const QString& _text, int _from, INOUT int& _length, intfState* _state) const;
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_URLMATCHER_H
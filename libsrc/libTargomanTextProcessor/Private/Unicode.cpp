@@ -0,0 +1,2114 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <algorithm>
+#include "Unicode.hpp"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+#define ARABIC_ZWNJ_UTF8        "\xE2\x80\x8C"
+#define SYMBOL_REMOVED_UTF8     "\xE2\x88\x85"
+
+/**
+ * @brief Normal form of a single code point. Tables of this struct must be sorted by code point so they can be
+ * binary searched. Sort order is checked at compile time.
+ */
+struct stuUnicodeNormalization{
+    uint        CodePoint;
+    const char* Normalized;     /** < UTF-8 encoded normal form. Empty string means character must be removed.*/
+};
+
+/**
+ * @brief Normal form of a range of code points.
+ */
+struct stuUnicodeRange{
+    uint        First;
+    uint        Last;
+    const char* Normalized;     /** < UTF-8 encoded normal form. nullptr means characters are accepted as is.*/
+};
+
+template <size_t N>
+constexpr bool isSortedByCodePoint(const stuUnicodeNormalization (&_table)[N]){
+    for (size_t i = 1; i < N; ++i)
+        if (_table[i - 1].CodePoint >= _table[i].CodePoint)
+            return false;
+    return true;
+}
+
+template <size_t N>
+constexpr bool isSortedByRange(const stuUnicodeRange (&_table)[N]){
+    for (size_t i = 0; i < N; ++i)
+        if (_table[i].First > _table[i].Last || (i > 0 && _table[i - 1].Last >= _table[i].First))
+            return false;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////
+///                           Greek                           ///
+///        http://www.unicode.org/charts/PDF/U0370.pdf        ///
+///        http://www.unicode.org/charts/PDF/U1F00.pdf        ///
+/////////////////////////////////////////////////////////////////
+static constexpr stuUnicodeNormalization UN_Greek[] = {
+    {0x386, "A"},                        // Ά
+    {0x388, "E"},                        // Έ
+    {0x389, "H"},                        // Ή
+    {0x38A, "I"},                        // Ί
+    {0x38C, "O"},                        // Ό
+    {0x38E, "Y"},
+    {0x390, "i"},
+    {0x391, "A"},
+    {0x392, "B"},
+    {0x395, "E"},
+    {0x396, "Z"},
+    {0x397, "H"},
+    {0x399, "I"},
+    {0x39A, "K"},
+    {0x39C, "M"},
+    {0x39D, "N"},
+    {0x3A1, "P"},
+    {0x3A4, "T"},
+    {0x3A5, "Y"},
+    {0x3A7, "X"},
+    {0x3AA, "I"},
+    {0x3AB, "Y"},
+    {0x3AF, "i"},
+    {0x3B9, "i"},
+    {0x3BA, "k"},
+    {0x3BD, "v"},
+    {0x3BF, "o"},
+    {0x3CA, "i"},
+    {0x3CB, "v"},
+    {0x3CC, "o"},
+    {0x3CD, "v"},
+    {0x3DC, "F"},
+    {0x3F3, "c"},
+    {0x3F9, "C"},
+    {0x3FA, "M"},
+    {0x1F08, "A"},
+    {0x1F09, "A"},
+    {0x1F0A, "A"},
+    {0x1F0B, "A"},
+    {0x1F0C, "A"},
+    {0x1F0D, "A"},
+    {0x1F0E, "A"},
+    {0x1F0F, "A"},
+    {0x1F18, "E"},
+    {0x1F19, "E"},
+    {0x1F1A, "E"},
+    {0x1F1B, "E"},
+    {0x1F1C, "E"},
+    {0x1F1D, "E"},
+    {0x1F28, "H"},
+    {0x1F29, "H"},
+    {0x1F2A, "H"},
+    {0x1F2B, "H"},
+    {0x1F2C, "H"},
+    {0x1F2D, "H"},
+    {0x1F2E, "H"},
+    {0x1F2F, "H"},
+    {0x1F30, "i"},
+    {0x1F31, "i"},
+    {0x1F32, "i"},
+    {0x1F33, "i"},
+    {0x1F34, "i"},
+    {0x1F35, "i"},
+    {0x1F36, "i"},
+    {0x1F37, "i"},
+    {0x1F38, "I"},
+    {0x1F39, "I"},
+    {0x1F3A, "I"},
+    {0x1F3B, "I"},
+    {0x1F3C, "I"},
+    {0x1F3D, "I"},
+    {0x1F3E, "I"},
+    {0x1F3F, "I"},
+    {0x1F40, "o"},
+    {0x1F41, "o"},
+    {0x1F42, "o"},
+    {0x1F43, "o"},
+    {0x1F44, "o"},
+    {0x1F45, "o"},
+    {0x1F48, "O"},
+    {0x1F49, "O"},
+    {0x1F4A, "O"},
+    {0x1F4B, "O"},
+    {0x1F4C, "O"},
+    {0x1F4D, "O"},
+    {0x1F50, "v"},
+    {0x1F51, "v"},
+    {0x1F52, "v"},
+    {0x1F53, "v"},
+    {0x1F54, "v"},
+    {0x1F55, "v"},
+    {0x1F56, "v"},
+    {0x1F57, "v"},
+    {0x1F59, "Y"},
+    {0x1F5B, "Y"},
+    {0x1F5D, "Y"},
+    {0x1F5F, "Y"},
+    {0x1F76, "i"},
+    {0x1F77, "i"},
+    {0x1F78, "o"},
+    {0x1F79, "o"},
+    {0x1F88, "A"},
+    {0x1F89, "A"},
+    {0x1F8A, "A"},
+    {0x1F8B, "A"},
+    {0x1F8C, "A"},
+    {0x1F8D, "A"},
+    {0x1F8E, "A"},
+    {0x1F8F, "A"},
+    {0x1F98, "H"},
+    {0x1F99, "H"},
+    {0x1F9A, "H"},
+    {0x1F9B, "H"},
+    {0x1F9C, "H"},
+    {0x1F9D, "H"},
+    {0x1F9E, "H"},
+    {0x1F9F, "H"},
+    {0x1FB8, "A"},
+    {0x1FB9, "A"},
+    {0x1FBA, "A"},
+    {0x1FBB, "A"},
+    {0x1FBC, "A"},
+    {0x1FC8, "E"},
+    {0x1FC9, "E"},
+    {0x1FCA, "H"},
+    {0x1FCB, "H"},
+    {0x1FCC, "H"},
+    {0x1FD0, "i"},
+    {0x1FD1, "i"},
+    {0x1FD2, "i"},
+    {0x1FD3, "i"},
+    {0x1FD6, "i"},
+    {0x1FD7, "i"},
+    {0x1FD8, "I"},
+    {0x1FD9, "I"},
+    {0x1FDA, "I"},
+    {0x1FDB, "I"},
+    {0x1FE8, "Y"},
+    {0x1FEB, "Y"},
+    {0x1FF8, "O"},
+    {0x1FF9, "O"}
+};
+static_assert(isSortedByCodePoint(UN_Greek), "UN_Greek must be sorted by code point");
+
+/////////////////////////////////////////////////////////////////
+///                          Cyrilic                          ///
+///        http://www.unicode.org/charts/PDF/U0400.pdf        ///
+///        http://www.unicode.org/charts/PDF/U0500.pdf        ///
+///        http://www.unicode.org/charts/PDF/U2DE0.pdf        ///
+///        http://www.unicode.org/charts/PDF/UA640.pdf        ///
+/////////////////////////////////////////////////////////////////
+static constexpr stuUnicodeNormalization UN_Cyrillic[] = {
+    {0x400, "E"},
+    {0x401, "E"},
+    {0x405, "S"},
+    {0x410, "A"},
+    {0x412, "B"},
+    {0x415, "E"},
+    {0x41A, "K"},
+    {0x41C, "M"},
+    {0x41D, "H"},
+    {0x41E, "O"},
+    {0x420, "P"},
+    {0x421, "C"},
+    {0x422, "T"},
+    {0x423, "y"},
+    {0x425, "X"},
+    {0x42C, "b"},
+    {0x430, "a"},
+    {0x432, "B"},
+    {0x435, "e"},
+    {0x43A, "K"},
+    {0x43C, "M"},
+    {0x43D, "H"},
+    {0x43E, "o"},
+    {0x440, "p"},
+    {0x441, "c"},
+    {0x442, "T"},
+    {0x443, "y"},
+    {0x445, "s"},
+    {0x44C, "b"},
+    {0x450, "e"},
+    {0x451, "e"},
+    {0x456, "i"},
+    {0x457, "i"},
+    {0x458, "j"},
+    {0x45C, "K"},
+    {0x45E, "y"},
+    {0x460, "W"},
+    {0x461, "w"},
+    {0x48E, "P"},
+    {0x48F, "P"},
+    {0x49A, "K"},
+    {0x49B, "K"},
+    {0x49C, "K"},
+    {0x49D, "K"},
+    {0x49E, "K"},
+    {0x49F, "w"},
+    {0x4A0, "K"},
+    {0x4A1, "K"},
+    {0x4D0, "A"},
+    {0x4D2, "A"},
+    {0x4D4, "AE"},
+    {0x4D5, "ae"},
+    {0x4D6, "E"},
+    {0x4EE, "y"},
+    {0x4EF, "y"},
+    {0x4F0, "y"},
+    {0x4F1, "y"},
+    {0x4F2, "y"},
+    {0x4F3, "y"},
+    {0x501, "d"},
+    {0x50C, "G"},
+    {0x51A, "Q"},
+    {0x51B, "q"},
+    {0x51C, "W"},
+    {0x51D, "w"},
+    {0x51E, "K"},
+    {0x51F, "K"},
+    {0x526, "h"},
+    {0x527, "h"},
+    {0xA640, "Z"},
+    {0xA641, "Z"},
+    {0xA642, "Z"},
+    {0xA643, "Z"},
+    {0xA690, "T"},
+    {0xA691, "T"}
+};
+static_assert(isSortedByCodePoint(UN_Cyrillic), "UN_Cyrillic must be sorted by code point");
+
+/////////////////////////////////////////////////////////////////
+///                           Latin                           ///
+///        http://www.unicode.org/charts/PDF/UFB00.pdf        ///
+/////////////////////////////////////////////////////////////////
+static constexpr stuUnicodeNormalization UN_Latin[] = {
+    {0xC0, "A"},                         // "À"
+    {0xC1, "A"},                         // "Á"
+    {0xC2, "A"},                         // "Â"
+    {0xC3, "A"},                         // "Ã"
+    {0xC4, "A"},                         // "Ä"
+    {0xC5, "A"},                         // "Å"
+    {0xC6, "AE"},                        // "Æ"
+    {0xC7, "C"},                         // "Ç"
+    {0xC8, "E"},                         // "È"
+    {0xC9, "E"},                         // "É"
+    {0xCA, "E"},                         // "Ê"
+    {0xCB, "E"},                         // "Ë"
+    {0xCC, "I"},                         // "Ì"
+    {0xCD, "I"},                         // "Í"
+    {0xCE, "I"},                         // "Î"
+    {0xCF, "I"},                         // "Ï"
+    {0xD0, "D"},                         // "Ð"
+    {0xD1, "N"},                         // "Ñ"
+    {0xD2, "O"},                         // "Ò"
+    {0xD3, "O"},                         // "Ó"
+    {0xD4, "O"},                         // "Ô"
+    {0xD5, "O"},                         // "Õ"
+    {0xD6, "O"},                         // "Ö"
+    {0xD9, "U"},                         // "Ù"
+    {0xDA, "U"},                         // "Ú"
+    {0xDB, "U"},                         // "Û"
+    {0xDC, "U"},                         // "Ü"
+    {0xDD, "Y"},                         // "Ý"
+    {0xE0, "a"},                         // "à"
+    {0xE1, "a"},                         // "á"
+    {0xE2, "a"},                         // "â"
+    {0xE3, "a"},                         // "ã"
+    {0xE4, "a"},                         // "ä"
+    {0xE5, "a"},                         // "å"
+    {0xE6, "ae"},                        // "æ"
+    {0xE7, "c"},                         // "ç"
+    {0xE8, "e"},                         // "è"
+    {0xE9, "e"},                         // "é"
+    {0xEA, "e"},                         // "ê"
+    {0xEB, "e"},                         // "ë"
+    {0xEC, "i"},                         // "ì"
+    {0xED, "i"},                         // "í"
+    {0xEE, "i"},                         // "î"
+    {0xEF, "i"},                         // "ï"
+    {0xF1, "n"},                         // "ñ"
+    {0xF2, "o"},                         // "ò"
+    {0xF3, "o"},                         // "ó"
+    {0xF4, "o"},                         // "ô"
+    {0xF5, "o"},                         // "õ"
+    {0xF6, "o"},                         // "ö"
+    {0xF9, "u"},                         // "ù"
+    {0xFA, "u"},                         // "ú"
+    {0xFB, "u"},                         // "û"
+    {0xFC, "u"},                         // "ü"
+    {0xFD, "y"},                         // "ý"
+    {0xFF, "y"},                         // "ÿ"
+    {0x100, "A"},                        // "Ā"
+    {0x101, "a"},                        // "ā"
+    {0x102, "A"},                        // "Ă"
+    {0x103, "a"},                        // "ă"
+    {0x104, "A"},                        // "Ą"
+    {0x105, "a"},                        // "ą"
+    {0x106, "C"},                        // "Ć"
+    {0x107, "c"},                        // "ć"
+    {0x108, "C"},                        // "Ĉ"
+    {0x109, "c"},                        // "ĉ"
+    {0x10A, "C"},                        // "Ċ"
+    {0x10B, "c"},                        // "ċ"
+    {0x10C, "C"},                        // "Č"
+    {0x10D, "c"},                        // "č"
+    {0x10E, "D"},                        // "Ď"
+    {0x10F, "d"},                        // "ď"
+    {0x110, "D"},                        // "Đ"
+    {0x111, "d"},                        // "đ"
+    {0x112, "E"},                        // "Ē"
+    {0x113, "e"},                        // "ē"
+    {0x114, "E"},                        // "Ĕ"
+    {0x115, "e"},                        // "ĕ"
+    {0x116, "E"},                        // "Ė"
+    {0x117, "e"},                        // "ė"
+    {0x118, "E"},                        // "Ę"
+    {0x119, "e"},                        // "ę"
+    {0x11A, "E"},                        // "Ě"
+    {0x11B, "e"},                        // "ě"
+    {0x11C, "G"},                        // "Ĝ"
+    {0x11D, "g"},                        // "ĝ"
+    {0x11E, "G"},                        // "Ğ"
+    {0x11F, "g"},                        // "ğ"
+    {0x120, "G"},                        // "Ġ"
+    {0x121, "g"},                        // "ġ"
+    {0x122, "G"},                        // "Ģ"
+    {0x123, "g"},                        // "ģ"
+    {0x124, "H"},                        // "Ĥ"
+    {0x125, "h"},                        // "ĥ"
+    {0x126, "H"},                        // "Ħ"
+    {0x127, "h"},                        // "ħ"
+    {0x128, "I"},                        // "Ĩ"
+    {0x129, "i"},                        // "ĩ"
+    {0x12A, "I"},                        // "Ī"
+    {0x12B, "i"},                        // "ī"
+    {0x12C, "I"},                        // "Ĭ"
+    {0x12D, "i"},                        // "ĭ"
+    {0x12E, "I"},                        // "Į"
+    {0x12F, "i"},                        // "į"
+    {0x130, "I"},                        // "İ"
+    {0x131, "i"},                        // "ı"
+    {0x132, "I"},                        // "Ĳ"
+    {0x133, "i"},                        // "ĳ"
+    {0x134, "J"},                        // "Ĵ"
+    {0x135, "j"},                        // "ĵ"
+    {0x136, "K"},                        // "Ķ"
+    {0x137, "k"},                        // "ķ"
+    {0x138, "k"},                        // "ĸ"
+    {0x139, "L"},                        // "Ĺ"
+    {0x13A, "l"},                        // "ĺ"
+    {0x13B, "L"},                        // "Ļ"
+    {0x13C, "l"},                        // "ļ"
+    {0x13D, "L"},                        // "Ľ"
+    {0x13E, "l"},                        // "ľ"
+    {0x13F, "L"},                        // "Ŀ"
+    {0x140, "l"},                        // "ŀ"
+    {0x141, "L"},                        // "Ł"
+    {0x142, "l"},                        // "ł"
+    {0x143, "N"},                        // "Ń"
+    {0x144, "n"},                        // "ń"
+    {0x145, "N"},                        // "Ņ"
+    {0x146, "n"},                        // "ņ"
+    {0x147, "N"},                        // "Ň"
+    {0x148, "n"},                        // "ň"
+    {0x149, "n"},                        // "ŉ"
+    {0x14C, "O"},                        // "Ō"
+    {0x14D, "o"},                        // "ō"
+    {0x14E, "O"},                        // "Ŏ"
+    {0x14F, "o"},                        // "ŏ"
+    {0x150, "O"},                        // "Ő"
+    {0x151, "o"},                        // "ő"
+    {0x152, "CE"},                       // "Œ"
+    {0x153, "ce"},                       // "œ"
+    {0x154, "R"},                        // "Ŕ"
+    {0x155, "r"},                        // "ŕ"
+    {0x156, "R"},                        // "Ŗ"
+    {0x157, "r"},                        // "ŗ"
+    {0x158, "R"},                        // "Ř"
+    {0x159, "r"},                        // "ř"
+    {0x15A, "S"},                        // "Ś"
+    {0x15B, "s"},                        // "ś"
+    {0x15C, "S"},                        // "Ŝ"
+    {0x15D, "s"},                        // "ŝ"
+    {0x15E, "S"},                        // "Ş"
+    {0x15F, "s"},                        // "ş"
+    {0x160, "S"},                        // "Š"
+    {0x161, "s"},                        // "š"
+    {0x162, "T"},                        // "Ţ"
+    {0x163, "t"},                        // "ţ"
+    {0x164, "T"},                        // "Ť"
+    {0x165, "t"},                        // "ť"
+    {0x166, "T"},                        // "Ŧ"
+    {0x167, "t"},                        // "ŧ"
+    {0x168, "U"},                        // "Ũ"
+    {0x169, "u"},                        // "ũ"
+    {0x16A, "U"},                        // "Ū"
+    {0x16B, "u"},                        // "ū"
+    {0x16C, "U"},                        // "Ŭ"
+    {0x16D, "u"},                        // "ŭ"
+    {0x16E, "U"},                        // "Ů"
+    {0x16F, "u"},                        // "ů"
+    {0x170, "U"},                        // "Ű"
+    {0x171, "u"},                        // "ű"
+    {0x172, "U"},                        // "Ų"
+    {0x173, "u"},                        // "ų"
+    {0x174, "W"},                        // "Ŵ"
+    {0x175, "w"},                        // "ŵ"
+    {0x176, "Y"},                        // "Ŷ"
+    {0x177, "y"},                        // "ŷ"
+    {0x178, "Y"},                        // "Ÿ"
+    {0x179, "Z"},                        // "Ź"
+    {0x17A, "z"},                        // "ź"
+    {0x17B, "Z"},                        // "Ż"
+    {0x17C, "z"},                        // "ż"
+    {0x17D, "Z"},                        // "Ž"
+    {0x17E, "z"},                        // "ž"
+    {0x180, "b"},                        // "ƀ"
+    {0x181, "B"},                        // "Ɓ"
+    {0x184, "b"},                        // "Ƅ"
+    {0x185, "b"},                        // "ƅ"
+    {0x187, "C"},                        // "Ƈ"
+    {0x188, "c"},                        // "ƈ"
+    {0x189, "D"},                        // "Ɖ"
+    {0x18A, "D"},                        // "Ɗ"
+    {0x18D, "o"},                        // "ƍ"
+    {0x192, "f"},                        // "ƒ"
+    {0x193, "G"},                        // "Ɠ"
+    {0x195, "hu"},                       // "ƕ"
+    {0x197, "I"},                        // "Ɨ"
+    {0x198, "K"},                        // "Ƙ"
+    {0x199, "k"},                        // "ƙ"
+    {0x19A, "l"},                        // "ƚ"
+    {0x1A0, "O"},                        // "Ơ"
+    {0x1A1, "o"},                        // "ơ"
+    {0x1A3, "oi"},                       // "ƣ"
+    {0x1A4, "P"},                        // "Ƥ"
+    {0x1A5, "p"},                        // "ƥ"
+    {0x1A6, "R"},                        // "Ʀ"
+    {0x1AB, "t"},                        // "ƫ"
+    {0x1AC, "T"},                        // "Ƭ"
+    {0x1AD, "t"},                        // "ƭ"
+    {0x1AE, "T"},                        // "Ʈ"
+    {0x1AF, "U"},                        // "Ư"
+    {0x1B0, "u"},                        // "ư"
+    {0x1B3, "Y"},                        // "Ƴ"
+    {0x1B4, "y"},                        // "ƴ"
+    {0x1B5, "Z"},                        // "Ƶ"
+    {0x1B6, "z"},                        // "ƶ"
+    {0x1C4, "DZ"},                       // "Ǆ"
+    {0x1C6, "dz"},                       // "ǆ"
+    {0x1C7, "LJ"},                       // "Ǉ"
+    {0x1C9, "lj"},                       // "ǉ"
+    {0x1CA, "NJ"},                       // "Ǌ"
+    {0x1CC, "nj"},                       // "ǌ"
+    {0x1CD, "A"},                        // "Ǎ"
+    {0x1CE, "a"},                        // "ǎ"
+    {0x1CF, "I"},                        // "Ǐ"
+    {0x1D0, "i"},                        // "ǐ"
+    {0x1D1, "O"},                        // "Ǒ"
+    {0x1D2, "o"},                        // "ǒ"
+    {0x1D3, "U"},                        // "Ǔ"
+    {0x1D4, "u"},                        // "ǔ"
+    {0x1D5, "U"},                        // "Ǖ"
+    {0x1D6, "u"},                        // "ǖ"
+    {0x1D7, "U"},                        // "Ǘ"
+    {0x1D8, "u"},                        // "ǘ"
+    {0x1D9, "U"},                        // "Ǚ"
+    {0x1DA, "u"},                        // "ǚ"
+    {0x1DB, "U"},                        // "Ǜ"
+    {0x1DC, "u"},                        // "ǜ"
+    {0x1DE, "A"},                        // "Ǟ"
+    {0x1DF, "a"},                        // "ǟ"
+    {0x1E0, "A"},                        // "Ǡ"
+    {0x1E1, "a"},                        // "ǡ"
+    {0x1E2, "AE"},                       // "Ǣ"
+    {0x1E3, "ae"},                       // "ǣ"
+    {0x1E6, "G"},                        // "Ǧ"
+    {0x1E7, "g"},                        // "ǧ"
+    {0x1E8, "K"},                        // "Ǩ"
+    {0x1E9, "k"},                        // "ǩ"
+    {0x1EA, "O"},                        // "Ǫ"
+    {0x1EB, "o"},                        // "ǫ"
+    {0x1EC, "O"},                        // "Ǭ"
+    {0x1ED, "o"},                        // "ǭ"
+    {0x1F0, "j"},                        // "ǰ"
+    {0x1F1, "DZ"},                       // "Ǳ"
+    {0x1F3, "dz"},                       // "ǳ"
+    {0x1F4, "G"},                        // "Ǵ"
+    {0x1F5, "g"},                        // "ǵ"
+    {0x1F6, "Hu"},                       // "Ƕ"
+    {0x1F8, "N"},                        // "Ǹ"
+    {0x1F9, "n"},                        // "ǹ"
+    {0x1FA, "A"},                        // "Ǻ"
+    {0x1FB, "a"},                        // "ǻ"
+    {0x1FC, "AE"},                       // "Ǽ"
+    {0x1FD, "ae"},                       // "ǽ"
+    {0x200, "A"},                        // "Ȁ"
+    {0x201, "a"},                        // "ȁ"
+    {0x202, "A"},                        // "Ȃ"
+    {0x203, "a"},                        // "ȃ"
+    {0x204, "E"},                        // "Ȅ"
+    {0x205, "e"},                        // "ȅ"
+    {0x206, "E"},                        // "Ȇ"
+    {0x207, "e"},                        // "ȇ"
+    {0x208, "I"},                        // "Ȉ"
+    {0x209, "i"},                        // "ȉ"
+    {0x20A, "I"},                        // "Ȋ"
+    {0x20B, "i"},                        // "ȋ"
+    {0x20C, "O"},                        // "Ȍ"
+    {0x20D, "o"},                        // "ȍ"
+    {0x20E, "O"},                        // "Ȏ"
+    {0x20F, "o"},                        // "ȏ"
+    {0x210, "R"},                        // "Ȑ"
+    {0x211, "r"},                        // "ȑ"
+    {0x212, "R"},                        // "Ȓ"
+    {0x213, "r"},                        // "ȓ"
+    {0x214, "U"},                        // "Ȕ"
+    {0x215, "u"},                        // "ȕ"
+    {0x216, "U"},                        // "Ȗ"
+    {0x217, "u"},                        // "ȗ"
+    {0x218, "S"},                        // "Ș"
+    {0x219, "s"},                        // "ș"
+    {0x21A, "T"},                        // "Ț"
+    {0x21B, "t"},                        // "ț"
+    {0x21E, "H"},                        // "Ȟ"
+    {0x21F, "h"},                        // "ȟ"
+    {0x221, "d"},                        // "ȡ"
+    {0x224, "Z"},                        // "Ȥ"
+    {0x225, "z"},                        // "ȥ"
+    {0x226, "A"},                        // "Ȧ"
+    {0x227, "a"},                        // "ȧ"
+    {0x228, "E"},                        // "Ȩ"
+    {0x229, "e"},                        // "ȩ"
+    {0x22A, "O"},                        // "Ȫ"
+    {0x22B, "o"},                        // "ȫ"
+    {0x22C, "O"},                        // "Ȭ"
+    {0x22D, "o"},                        // "ȭ"
+    {0x22E, "O"},                        // "Ȯ"
+    {0x22F, "o"},                        // "ȯ"
+    {0x230, "O"},                        // "Ȱ"
+    {0x231, "o"},                        // "ȱ"
+    {0x232, "Y"},                        // "Ȳ"
+    {0x233, "y"},                        // "ȳ"
+    {0x234, "l"},                        // "ȴ"
+    {0x235, "n"},                        // "ȵ"
+    {0x236, "t"},                        // "ȶ"
+    {0x237, "j"},                        // "ȷ"
+    {0x23A, "A"},                        // "Ⱥ"
+    {0x23B, "C"},                        // "Ȼ"
+    {0x23C, "c"},                        // "ȼ"
+    {0x23D, "L"},                        // "Ƚ"
+    {0x23E, "T"},                        // "Ⱦ"
+    {0x23F, "s"},                        // "ȿ"
+    {0x243, "B"},                        // "Ƀ"
+    {0x244, "U"},                        // "Ʉ"
+    {0x246, "E"},                        // "Ɇ"
+    {0x247, "e"},                        // "ɇ"
+    {0x248, "J"},                        // "Ɉ"
+    {0x249, "i"},                        // "ɉ"
+    {0x24A, "Q"},                        // "Ɋ"
+    {0x24B, "q"},                        // "ɋ"
+    {0x24C, "R"},                        // "Ɍ"
+    {0x24E, "Y"},                        // "Ɏ"
+    {0x24F, "y"},                        // "ɏ"
+    {0x253, "b"},                        // "ɓ"
+    {0x255, "c"},                        // "ɕ"
+    {0x256, "d"},                        // "ɖ"
+    {0x257, "d"},                        // "ɗ"
+    {0x260, "g"},                        // "ɠ"
+    {0x261, "g"},                        // "ɡ"
+    {0x262, "G"},                        // "ɢ"
+    {0x266, "h"},                        // "ɦ"
+    {0x268, "i"},                        // "ɨ"
+    {0x26A, "i"},                        // "ɪ"
+    {0x26B, "l"},                        // "ɫ"
+    {0x26C, "l"},                        // "ɬ"
+    {0x26D, "l"},                        // "ɭ"
+    {0x276, "oe"},                       // "ɶ"
+    {0x280, "r"},                        // "ʀ"
+    {0x28F, "y"},                        // "ʏ"
+    {0x290, "z"},                        // "ʐ"
+    {0x291, "z"},                        // "ʑ"
+    {0x29B, "g"},                        // "ʛ"
+    {0x29C, "h"},                        // "ʜ"
+    {0x29D, "j"},                        // "ʝ"
+    {0x29F, "l"},                        // "ʟ"
+    {0x2A3, "dz"},                       // "ʣ"
+    {0x2A5, "dz"},                       // "ʥ"
+    {0x2A6, "ts"},                       // "ʦ"
+    {0x2A8, "tc"},                       // "ʨ"
+    {0x2AB, "tz"},                       // "ʫ"
+    {0x1D00, "A"},
+    {0x1D01, "AE"},
+    {0x1D03, "B"},
+    {0x1D04, "C"},
+    {0x1D05, "D"},
+    {0x1D06, "D"},
+    {0x1D07, "E"},
+    {0x1D09, "!"},
+    {0x1D0A, "J"},
+    {0x1D0B, "K"},
+    {0x1D0C, "L"},
+    {0x1D0D, "M"},
+    {0x1D0F, "o"},
+    {0x1D18, "P"},
+    {0x1D1B, "T"},
+    {0x1D1C, "U"},
+    {0x1D20, "V"},
+    {0x1D21, "W"},
+    {0x1D22, "Z"},
+    {0x2103, "°C"},
+    {0x2109, "°F"},
+    {0x210E, "h"},                       // "h"
+    {0x210F, "h"},                       // "h"
+    {0x211E, "R"},                       // "SM"
+    {0x2120, "SM"},                      // "SM"
+    {0x2121, "Tel"},                     // "SM"
+    {0x2122, "TM"},                      // "SM"
+    {0x212B, "A"},                       // "SM"
+    {0x2460, "(1)"},                     // ①
+    {0x2461, "(2)"},                     // ①
+    {0x2462, "(3)"},                     // ①
+    {0x2463, "(4)"},                     // ①
+    {0x2464, "(5)"},                     // ①
+    {0x2465, "(6)"},                     // ①
+    {0x2466, "(7)"},                     // ①
+    {0x2467, "(8)"},                     // ①
+    {0x2468, "(9)"},                     // ①
+    {0x2469, "(10)"},                    // ①
+    {0x246A, "(11)"},                    // ①
+    {0x246B, "(12)"},                    // ①
+    {0x246C, "(13)"},                    // ①
+    {0x246D, "(14)"},                    // ①
+    {0x246E, "(15)"},                    // ①
+    {0x246F, "(16)"},                    // ①
+    {0x2470, "(17)"},                    // ①
+    {0x2471, "(18)"},                    // ①
+    {0x2472, "(19)"},                    // ①
+    {0x2473, "(20)"},                    // ①
+    {0x2474, "(1)"},                     // ①
+    {0x2475, "(2)"},                     // ①
+    {0x2476, "(3)"},                     // ①
+    {0x2477, "(4)"},                     // ①
+    {0x2478, "(5)"},                     // ①
+    {0x2479, "(6)"},                     // ①
+    {0x247A, "(7)"},                     // ①
+    {0x247B, "(8)"},                     // ①
+    {0x247C, "(9)"},                     // ①
+    {0x247D, "(10)"},                    // ①
+    {0x247E, "(11)"},                    // ①
+    {0x247F, "(12)"},                    // ①
+    {0x2480, "(13)"},                    // ①
+    {0x2481, "(14)"},                    // ①
+    {0x2482, "(15)"},                    // ①
+    {0x2483, "(16)"},                    // ①
+    {0x2484, "(17)"},                    // ①
+    {0x2485, "(18)"},                    // ①
+    {0x2486, "(19)"},                    // ①
+    {0x2487, "(20)"},                    // ①
+    {0x2488, "1"},                       // ①
+    {0x2489, "2"},                       // ①
+    {0x248A, "3"},                       // ①
+    {0x248B, "4"},                       // ①
+    {0x248C, "5"},                       // ①
+    {0x248D, "6"},                       // ①
+    {0x248E, "7"},                       // ①
+    {0x248F, "8"},                       // ①
+    {0x2490, "9"},                       // ①
+    {0x2491, "(10)"},                    // ①
+    {0x2492, "(11)"},                    // ①
+    {0x2493, "(12)"},                    // ①
+    {0x2494, "(13)"},                    // ①
+    {0x2495, "(14)"},                    // ①
+    {0x2496, "(15)"},                    // ①
+    {0x2497, "(16)"},                    // ①
+    {0x2498, "(17)"},                    // ①
+    {0x2499, "(18)"},                    // ①
+    {0x249A, "(19)"},                    // ①
+    {0x249B, "(20)"},                    // ①
+    {0x249C, "(a)"},                     // ①
+    {0x249D, "(b)"},                     // ①
+    {0x249E, "(c)"},                     // ①
+    {0x249F, "(d)"},                     // ①
+    {0x24A0, "(e)"},                     // ①
+    {0x24A1, "(f)"},                     // ①
+    {0x24A2, "(g)"},                     // ①
+    {0x24A3, "(h)"},                     // ①
+    {0x24A4, "(i)"},                     // ①
+    {0x24A5, "(j)"},                     // ①
+    {0x24A6, "(k)"},                     // ①
+    {0x24A7, "(l)"},                     // ①
+    {0x24A8, "(m)"},                     // ①
+    {0x24A9, "(n)"},                     // ①
+    {0x24AA, "(o)"},                     // ①
+    {0x24AB, "(p)"},                     // ①
+    {0x24AC, "(q)"},                     // ①
+    {0x24AD, "(r)"},                     // ①
+    {0x24AE, "(s)"},                     // ①
+    {0x24AF, "(t)"},                     // ①
+    {0x24B0, "(u)"},                     // ①
+    {0x24B1, "(v)"},                     // ①
+    {0x24B2, "(w)"},                     // ①
+    {0x24B3, "(x)"},                     // ①
+    {0x24B4, "(y)"},                     // ①
+    {0x24B5, "(z)"},                     // ①
+    {0x24B6, "(A)"},                     // ①
+    {0x24B7, "(B)"},                     // ①
+    {0x24B8, "(C)"},                     // ①
+    {0x24B9, "(D)"},                     // ①
+    {0x24BA, "(E)"},                     // ①
+    {0x24BB, "(F)"},                     // ①
+    {0x24BC, "(G)"},                     // ①
+    {0x24BD, "(H)"},                     // ①
+    {0x24BE, "(I)"},                     // ①
+    {0x24BF, "(J)"},                     // ①
+    {0x24C0, "(K)"},                     // ①
+    {0x24C1, "(L)"},                     // ①
+    {0x24C2, "(M)"},                     // ①
+    {0x24C3, "(N)"},                     // ①
+    {0x24C4, "(O)"},                     // ①
+    {0x24C5, "(P)"},                     // ①
+    {0x24C6, "(Q)"},                     // ①
+    {0x24C7, "(R)"},                     // ①
+    {0x24C8, "(S)"},                     // ①
+    {0x24C9, "(T)"},                     // ①
+    {0x24CA, "(U)"},                     // ①
+    {0x24CB, "(V)"},                     // ①
+    {0x24CC, "(W)"},                     // ①
+    {0x24CD, "(X)"},                     // ①
+    {0x24CE, "(Y)"},                     // ①
+    {0x24CF, "(Z)"},                     // ①
+    {0x24D0, "(a)"},                     // ①
+    {0x24D1, "(b)"},                     // ①
+    {0x24D2, "(c)"},                     // ①
+    {0x24D3, "(d)"},                     // ①
+    {0x24D4, "(e)"},                     // ①
+    {0x24D5, "(f)"},                     // ①
+    {0x24D6, "(g)"},                     // ①
+    {0x24D7, "(h)"},                     // ①
+    {0x24D8, "(i)"},                     // ①
+    {0x24D9, "(j)"},                     // ①
+    {0x24DA, "(k)"},                     // ①
+    {0x24DB, "(l)"},                     // ①
+    {0x24DC, "(m)"},                     // ①
+    {0x24DD, "(n)"},                     // ①
+    {0x24DE, "(o)"},                     // ①
+    {0x24DF, "(p)"},                     // ①
+    {0x24E0, "(q)"},                     // ①
+    {0x24E1, "(r)"},                     // ①
+    {0x24E2, "(s)"},                     // ①
+    {0x24E3, "(t)"},                     // ①
+    {0x24E4, "(u)"},                     // ①
+    {0x24E5, "(v)"},                     // ①
+    {0x24E6, "(w)"},                     // ①
+    {0x24E7, "(x)"},                     // ①
+    {0x24E8, "(y)"},                     // ①
+    {0x24E9, "(z)"},                     // ①
+    {0x24EA, "(0)"},                     // ①
+    {0x24EB, "(11)"},                    // ①
+    {0x24EC, "(12)"},                    // ①
+    {0x24ED, "(13)"},                    // ①
+    {0x24EE, "(14)"},                    // ①
+    {0x24EF, "(15)"},                    // ①
+    {0x24F0, "(16)"},                    // ①
+    {0x24F1, "(17)"},                    // ①
+    {0x24F2, "(18)"},                    // ①
+    {0x24F3, "(19)"},                    // ①
+    {0x24F4, "(20)"},                    // ①
+    {0x24F5, "1"},                       // ①
+    {0x24F6, "2"},                       // ①
+    {0x24F7, "3"},                       // ①
+    {0x24F8, "4"},                       // ①
+    {0x24F9, "5"},                       // ①
+    {0x24FA, "6"},                       // ①
+    {0x24FB, "7"},                       // ①
+    {0x24FC, "8"},                       // ①
+    {0x24FD, "9"},                       // ①
+    {0x24FE, "(10)"},                    // ①
+    {0x24FF, "(0)"},                     // ①
+    {0x2721, SYMBOL_REMOVED_UTF8},
+    {0x2753, "?"},                       // ①
+    {0x2754, "?"},                       // ①
+    {0x2755, "!"},
+    {0x2756, "*"},
+    {0x2757, "!"},
+    {0x2758, "|"},
+    {0x2759, "|"},
+    {0x275A, "|"},
+    {0x275B, "'"},
+    {0x275C, "'"},
+    {0x275D, "\""},
+    {0x275E, "\""},
+    {0x275F, "'"},
+    {0x2760, "\""},
+    {0x2762, "!"},
+    {0x2763, "!"},
+    {0x2776, "(1)"},                     // ①
+    {0x2777, "(2)"},                     // ①
+    {0x2778, "(3)"},                     // ①
+    {0x2779, "(4)"},                     // ①
+    {0x277A, "(5)"},                     // ①
+    {0x277B, "(6)"},                     // ①
+    {0x277C, "(7)"},                     // ①
+    {0x277D, "(8)"},                     // ①
+    {0x277E, "(9)"},                     // ①
+    {0x277F, "(10)"},                    // ①
+    {0x2780, "(1)"},                     // ①
+    {0x2781, "(2)"},                     // ①
+    {0x2782, "(3)"},                     // ①
+    {0x2783, "(4)"},                     // ①
+    {0x2784, "(5)"},                     // ①
+    {0x2785, "(6)"},                     // ①
+    {0x2786, "(7)"},                     // ①
+    {0x2787, "(8)"},                     // ①
+    {0x2788, "(9)"},                     // ①
+    {0x2789, "(10)"},                    // ①
+    {0x278A, "(1)"},                     // ①
+    {0x278B, "(2)"},                     // ①
+    {0x278C, "(3)"},                     // ①
+    {0x278D, "(4)"},                     // ①
+    {0x278E, "(5)"},                     // ①
+    {0x278F, "(6)"},                     // ①
+    {0x2790, "(7)"},                     // ①
+    {0x2791, "(8)"},                     // ①
+    {0x2792, "(9)"},                     // ①
+    {0x2793, "(10)"},                    // ①
+    {0x2795, "+"},                       // ①
+    {0x2796, "-"},                       // ①
+    {0x2C60, "L"},
+    {0x2C61, "l"},
+    {0x2C62, "L"},
+    {0x2C63, "P"},
+    {0x2C64, "R"},
+    {0x2C65, "a"},
+    {0x2C66, "t"},
+    {0x2C67, "H"},
+    {0x2C68, "h"},
+    {0x2C69, "K"},
+    {0x2C6A, "k"},
+    {0x2C6B, "Z"},
+    {0x2C6C, "z"},
+    {0x2C6E, "M"},
+    {0x2C71, "v"},
+    {0x2C72, "W"},
+    {0x2C73, "w"},
+    {0x2C74, "v"},
+    {0x2C75, SYMBOL_REMOVED_UTF8},
+    {0x2C76, SYMBOL_REMOVED_UTF8},
+    {0x2C77, "ⱷ"},
+    {0x2C78, "e"},
+    {0x2C7C, "ⱼ"},
+    {0x2C7D, "ⱽ"},
+    {0x2C7E, "S"},
+    {0x2C7F, "Z"},
+    {0xFB00, "ff"},
+    {0xFB01, "fi"},
+    {0xFB02, "fl"},
+    {0xFB03, "ffi"},
+    {0xFB04, "ffl"},
+    {0xFB05, "st"},
+    {0xFB06, "st"},
+    {0xFFE0, "¢"},
+    {0xFFE1, "£"},
+    {0xFFE5, "¥"},
+    {0xFFE6, "₩"}
+};
+static_assert(isSortedByCodePoint(UN_Latin), "UN_Latin must be sorted by code point");
+
+/////////////////////////////////////////////////////////////////
+///                           Arabic                          ///
+///        http://www.unicode.org/charts/PDF/U0600.pdf        ///
+///        http://www.unicode.org/charts/PDF/U0750.pdf        ///
+///        http://www.unicode.org/charts/PDF/U08A0.pdf        ///
+///        http://www.unicode.org/charts/PDF/UFB50.pdf        ///
+///        http://www.unicode.org/charts/PDF/UFE70.pdf        ///
+/////////////////////////////////////////////////////////////////
+static constexpr stuUnicodeNormalization UN_Arabic[] = {
+    {0x620, "ی"},
+    {0x63B, "ک"},
+    {0x63C, "ک"},
+    {0x63D, "ی"},
+    {0x63E, "ی"},
+    {0x63F, "ی"},
+    {0x643, "ک"},
+    {0x649, "ی"},
+    {0x64A, "ی"},
+    {0x66E, "ب"},
+    {0x66F, "ق"},
+    {0x672, "أ"},
+    {0x673, "إ"},
+    {0x675, "أ"},
+    {0x676, "ؤ"},
+    {0x677, "ؤ"},
+    {0x678, "ی"},
+    {0x679, "ت"},
+    {0x67A, "ت"},
+    {0x67B, "ب"},
+    {0x67C, "ت"},
+    {0x67D, "ث"},
+    {0x67F, "ت"},
+    {0x680, "ب"},
+    {0x681, "ح"},
+    {0x682, "ح"},
+    {0x683, "ج"},
+    {0x684, "ج"},
+    {0x685, "ح"},
+    {0x687, "چ"},
+    {0x688, "د"},
+    {0x689, "د"},
+    {0x68A, "د"},
+    {0x68B, "د"},
+    {0x68C, "ذ"},
+    {0x68D, "د"},
+    {0x68E, "د"},
+    {0x68F, "د"},
+    {0x690, "د"},
+    {0x691, "ر"},
+    {0x692, "ر"},
+    {0x693, "ر"},
+    {0x694, "ر"},
+    {0x695, "ر"},
+    {0x696, "ر"},
+    {0x697, "ز"},
+    {0x699, "ژ"},
+    {0x69A, "س"},
+    {0x69B, "س"},
+    {0x69C, "ش"},
+    {0x69D, "ص"},
+    {0x69E, "ص"},
+    {0x69F, "ط"},
+    {0x6A0, "ع"},
+    {0x6A1, "ف"},
+    {0x6A2, "ف"},
+    {0x6A3, "ف"},
+    {0x6A4, "ف"},
+    {0x6A5, "ف"},
+    {0x6A6, "ف"},
+    {0x6A7, "ق"},
+    {0x6A8, "ق"},
+    {0x6A9, "ک"},
+    {0x6AA, "ک"},
+    {0x6AB, "ک"},
+    {0x6AC, "ک"},
+    {0x6AD, "ک"},
+    {0x6AE, "ک"},
+    {0x6B0, "گ"},
+    {0x6B1, "گ"},
+    {0x6B2, "گ"},
+    {0x6B3, "گ"},
+    {0x6B4, "گ"},
+    {0x6B5, "ل"},
+    {0x6B6, "ل"},
+    {0x6B7, "ل"},
+    {0x6B8, "ل"},
+    {0x6B9, "ن"},
+    {0x6BA, "ن"},
+    {0x6BB, "ن"},
+    {0x6BC, "ن"},
+    {0x6BD, "ن"},
+    {0x6BE, "ه"},
+    {0x6BF, "چ"},
+    {0x6C0, "ه"},
+    {0x6C1, "ه"},
+    {0x6C2, "ه"},
+    {0x6C3, "ه"},
+    {0x6C4, "و"},
+    {0x6C5, "و"},
+    {0x6C6, "و"},
+    {0x6C7, "و"},
+    {0x6C8, "و"},
+    {0x6C9, "و"},
+    {0x6CA, "و"},
+    {0x6CB, "و"},
+    {0x6CC, "ی"},
+    {0x6CD, "ی"},
+    {0x6CE, "ی"},
+    {0x6CF, "و"},
+    {0x6D0, "ی"},
+    {0x6D1, "ی"},
+    {0x6D2, "ی"},
+    {0x6D3, "ی"},
+    {0x6D5, "ه"},
+    {0x6DD, SYMBOL_REMOVED_UTF8},        // SYMBOL_REMOVED
+    {0x6DE, SYMBOL_REMOVED_UTF8},        // SYMBOL_REMOVED
+    {0x6E9, SYMBOL_REMOVED_UTF8},        // SYMBOL_REMOVED
+    {0x6EE, "د"},
+    {0x6EF, "ر"},
+    {0x6FA, "ش"},
+    {0x6FB, "ض"},
+    {0x6FC, "غ"},
+    {0x6FE, "م"},
+    {0x6FF, "ه"},
+    {0x750, "ب"},
+    {0x751, "ث"},
+    {0x752, "ب"},
+    {0x753, "ت"},
+    {0x754, "ب"},
+    {0x755, "ب"},
+    {0x756, "ب"},
+    {0x757, "ح"},
+    {0x758, "ح"},
+    {0x759, "د"},
+    {0x75A, "د"},
+    {0x75B, "ر"},
+    {0x75C, "س"},
+    {0x75D, "ع"},
+    {0x75E, "ع"},
+    {0x75F, "ع"},
+    {0x760, "ف"},
+    {0x761, "ف"},
+    {0x762, "ک"},
+    {0x763, "ک"},
+    {0x764, "ک"},
+    {0x765, "م"},
+    {0x766, "م"},
+    {0x767, "ن"},
+    {0x768, "ن"},
+    {0x769, "ن"},
+    {0x76A, "ل"},
+    {0x76B, "ز"},
+    {0x76C, "ز"},
+    {0x76D, "ح"},
+    {0x76E, "ح"},
+    {0x76F, "ک"},
+    {0xFB50, "أ"},
+    {0xFB51, "أ"},
+    {0xFB52, "ب" ARABIC_ZWNJ_UTF8},
+    {0xFB53, "ب" ARABIC_ZWNJ_UTF8},
+    {0xFB54, "ب"},
+    {0xFB55, "ب"},
+    {0xFB56, "پ" ARABIC_ZWNJ_UTF8},
+    {0xFB57, "پ" ARABIC_ZWNJ_UTF8},
+    {0xFB58, "پ"},
+    {0xFB59, "پ"},
+    {0xFB5A, "پ" ARABIC_ZWNJ_UTF8},
+    {0xFB5B, "پ" ARABIC_ZWNJ_UTF8},
+    {0xFB5C, "پ"},
+    {0xFB5D, "پ"},
+    {0xFB5E, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFB5F, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFB60, "ت"},
+    {0xFB61, "ت"},
+    {0xFB62, "ث" ARABIC_ZWNJ_UTF8},
+    {0xFB63, "ث" ARABIC_ZWNJ_UTF8},
+    {0xFB64, "ث"},
+    {0xFB65, "ث"},
+    {0xFB66, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFB67, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFB68, "ت"},
+    {0xFB69, "ت"},
+    {0xFB6A, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFB6B, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFB6C, "ف"},
+    {0xFB6D, "ف"},
+    {0xFB6E, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFB6F, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFB70, "ف"},
+    {0xFB71, "ف"},
+    {0xFB72, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFB73, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFB74, "ج"},
+    {0xFB75, "ج"},
+    {0xFB76, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFB77, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFB78, "ج"},
+    {0xFB79, "ج"},
+    {0xFB7A, "چ" ARABIC_ZWNJ_UTF8},
+    {0xFB7B, "چ" ARABIC_ZWNJ_UTF8},
+    {0xFB7C, "چ"},
+    {0xFB7D, "چ"},
+    {0xFB7E, "چ" ARABIC_ZWNJ_UTF8},
+    {0xFB7F, "چ" ARABIC_ZWNJ_UTF8},
+    {0xFB80, "چ"},
+    {0xFB81, "چ"},
+    {0xFB82, "د"},
+    {0xFB83, "د"},
+    {0xFB84, "د"},
+    {0xFB85, "د"},
+    {0xFB86, "د"},
+    {0xFB87, "د"},
+    {0xFB88, "د"},
+    {0xFB89, "د"},
+    {0xFB8A, "ژ"},
+    {0xFB8B, "ژ"},
+    {0xFB8C, "ر"},
+    {0xFB8D, "ر"},
+    {0xFB8E, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFB8F, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFB90, "ک"},
+    {0xFB91, "ک"},
+    {0xFB92, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB93, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB94, "گ"},
+    {0xFB95, "گ"},
+    {0xFB96, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB97, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB98, "گ"},
+    {0xFB99, "گ"},
+    {0xFB9A, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB9B, "گ" ARABIC_ZWNJ_UTF8},
+    {0xFB9C, "گ"},
+    {0xFB9D, "گ"},
+    {0xFB9E, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFB9F, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFBA0, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFBA1, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFBA2, "ن"},
+    {0xFBA3, "ن"},
+    {0xFBA4, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFBA5, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFBA6, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFBA7, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFBA8, "ه"},
+    {0xFBA9, "ه"},
+    {0xFBAA, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFBAB, "ه"},
+    {0xFBAC, "ه"},
+    {0xFBAD, "ه"},
+    {0xFBAE, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBAF, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBB0, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBB1, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBD3, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFBD4, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFBD5, "ک"},
+    {0xFBD6, "ک"},
+    {0xFBD7, "ؤ"},
+    {0xFBD8, "ؤ"},
+    {0xFBD9, "ؤ"},
+    {0xFBDA, "ؤ"},
+    {0xFBDB, "ؤ"},
+    {0xFBDC, "ؤ"},
+    {0xFBDD, "ؤ"},
+    {0xFBDE, "ؤ"},
+    {0xFBDF, "ؤ"},
+    {0xFBE0, "و"},
+    {0xFBE1, "و"},
+    {0xFBE2, "و"},
+    {0xFBE3, "و"},
+    {0xFBE4, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBE5, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBE6, "ی"},
+    {0xFBE7, "ی"},
+    {0xFBE8, "ئ"},
+    {0xFBE9, "ئ"},
+    {0xFBEA, "ئ"},
+    {0xFBEB, "ئ"},
+    {0xFBEC, "ئ"},
+    {0xFBED, "ئ"},
+    {0xFBEE, "ئ"},
+    {0xFBEF, "ئ"},
+    {0xFBF0, "ئ"},
+    {0xFBF1, "ئ"},
+    {0xFBF2, "ئ"},
+    {0xFBF3, "ئ"},
+    {0xFBF4, "ئ"},
+    {0xFBF5, "ئ"},
+    {0xFBF6, "ئ"},
+    {0xFBF7, "ئ"},
+    {0xFBF8, "ئ"},
+    {0xFBF9, "ئ"},
+    {0xFBFA, "ئ"},
+    {0xFBFB, "ئ"},
+    {0xFBFC, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBFD, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFBFE, "ی"},
+    {0xFBFF, "ی"},
+    {0xFC00, "MIXED_ARABIC_LETTERS"},
+    {0xFC01, "MIXED_ARABIC_LETTERS"},
+    {0xFC02, "MIXED_ARABIC_LETTERS"},
+    {0xFC03, "MIXED_ARABIC_LETTERS"},
+    {0xFC04, "MIXED_ARABIC_LETTERS"},
+    {0xFC05, "MIXED_ARABIC_LETTERS"},
+    {0xFC06, "MIXED_ARABIC_LETTERS"},
+    {0xFC07, "MIXED_ARABIC_LETTERS"},
+    {0xFC08, "MIXED_ARABIC_LETTERS"},
+    {0xFC09, "MIXED_ARABIC_LETTERS"},
+    {0xFC0A, "MIXED_ARABIC_LETTERS"},
+    {0xFC0B, "MIXED_ARABIC_LETTERS"},
+    {0xFC0C, "MIXED_ARABIC_LETTERS"},
+    {0xFC0D, "MIXED_ARABIC_LETTERS"},
+    {0xFC0E, "MIXED_ARABIC_LETTERS"},
+    {0xFC0F, "MIXED_ARABIC_LETTERS"},
+    {0xFC10, "MIXED_ARABIC_LETTERS"},
+    {0xFC11, "MIXED_ARABIC_LETTERS"},
+    {0xFC12, "MIXED_ARABIC_LETTERS"},
+    {0xFC13, "MIXED_ARABIC_LETTERS"},
+    {0xFC14, "MIXED_ARABIC_LETTERS"},
+    {0xFC15, "MIXED_ARABIC_LETTERS"},
+    {0xFC16, "MIXED_ARABIC_LETTERS"},
+    {0xFC17, "MIXED_ARABIC_LETTERS"},
+    {0xFC18, "MIXED_ARABIC_LETTERS"},
+    {0xFC19, "MIXED_ARABIC_LETTERS"},
+    {0xFC1A, "MIXED_ARABIC_LETTERS"},
+    {0xFC1B, "MIXED_ARABIC_LETTERS"},
+    {0xFC1C, "MIXED_ARABIC_LETTERS"},
+    {0xFC1D, "MIXED_ARABIC_LETTERS"},
+    {0xFC1E, "MIXED_ARABIC_LETTERS"},
+    {0xFC1F, "MIXED_ARABIC_LETTERS"},
+    {0xFC20, "MIXED_ARABIC_LETTERS"},
+    {0xFC21, "MIXED_ARABIC_LETTERS"},
+    {0xFC22, "MIXED_ARABIC_LETTERS"},
+    {0xFC23, "MIXED_ARABIC_LETTERS"},
+    {0xFC24, "MIXED_ARABIC_LETTERS"},
+    {0xFC25, "MIXED_ARABIC_LETTERS"},
+    {0xFC26, "MIXED_ARABIC_LETTERS"},
+    {0xFC27, "MIXED_ARABIC_LETTERS"},
+    {0xFC28, "MIXED_ARABIC_LETTERS"},
+    {0xFC29, "MIXED_ARABIC_LETTERS"},
+    {0xFC2A, "MIXED_ARABIC_LETTERS"},
+    {0xFC2B, "MIXED_ARABIC_LETTERS"},
+    {0xFC2C, "MIXED_ARABIC_LETTERS"},
+    {0xFC2D, "MIXED_ARABIC_LETTERS"},
+    {0xFC2E, "MIXED_ARABIC_LETTERS"},
+    {0xFC2F, "MIXED_ARABIC_LETTERS"},
+    {0xFC30, "MIXED_ARABIC_LETTERS"},
+    {0xFC31, "MIXED_ARABIC_LETTERS"},
+    {0xFC32, "MIXED_ARABIC_LETTERS"},
+    {0xFC33, "MIXED_ARABIC_LETTERS"},
+    {0xFC34, "MIXED_ARABIC_LETTERS"},
+    {0xFC35, "MIXED_ARABIC_LETTERS"},
+    {0xFC36, "MIXED_ARABIC_LETTERS"},
+    {0xFC37, "MIXED_ARABIC_LETTERS"},
+    {0xFC38, "MIXED_ARABIC_LETTERS"},
+    {0xFC39, "MIXED_ARABIC_LETTERS"},
+    {0xFC3A, "MIXED_ARABIC_LETTERS"},
+    {0xFC3B, "MIXED_ARABIC_LETTERS"},
+    {0xFC3C, "MIXED_ARABIC_LETTERS"},
+    {0xFC3D, "MIXED_ARABIC_LETTERS"},
+    {0xFC3E, "MIXED_ARABIC_LETTERS"},
+    {0xFC3F, "MIXED_ARABIC_LETTERS"},
+    {0xFC40, "MIXED_ARABIC_LETTERS"},
+    {0xFC41, "MIXED_ARABIC_LETTERS"},
+    {0xFC42, "MIXED_ARABIC_LETTERS"},
+    {0xFC43, "MIXED_ARABIC_LETTERS"},
+    {0xFC44, "MIXED_ARABIC_LETTERS"},
+    {0xFC45, "MIXED_ARABIC_LETTERS"},
+    {0xFC46, "MIXED_ARABIC_LETTERS"},
+    {0xFC47, "MIXED_ARABIC_LETTERS"},
+    {0xFC48, "MIXED_ARABIC_LETTERS"},
+    {0xFC49, "MIXED_ARABIC_LETTERS"},
+    {0xFC4A, "MIXED_ARABIC_LETTERS"},
+    {0xFC4B, "MIXED_ARABIC_LETTERS"},
+    {0xFC4C, "MIXED_ARABIC_LETTERS"},
+    {0xFC4D, "MIXED_ARABIC_LETTERS"},
+    {0xFC4E, "MIXED_ARABIC_LETTERS"},
+    {0xFC4F, "MIXED_ARABIC_LETTERS"},
+    {0xFC50, "MIXED_ARABIC_LETTERS"},
+    {0xFC51, "MIXED_ARABIC_LETTERS"},
+    {0xFC52, "MIXED_ARABIC_LETTERS"},
+    {0xFC53, "MIXED_ARABIC_LETTERS"},
+    {0xFC54, "MIXED_ARABIC_LETTERS"},
+    {0xFC55, "MIXED_ARABIC_LETTERS"},
+    {0xFC56, "MIXED_ARABIC_LETTERS"},
+    {0xFC57, "MIXED_ARABIC_LETTERS"},
+    {0xFC58, "MIXED_ARABIC_LETTERS"},
+    {0xFC59, "MIXED_ARABIC_LETTERS"},
+    {0xFC5A, "MIXED_ARABIC_LETTERS"},
+    {0xFC5B, "ذ"},
+    {0xFC5C, "ر"},
+    {0xFC5D, "ئ"},
+    {0xFC64, "MIXED_ARABIC_LETTERS"},
+    {0xFC65, "MIXED_ARABIC_LETTERS"},
+    {0xFC66, "MIXED_ARABIC_LETTERS"},
+    {0xFC67, "MIXED_ARABIC_LETTERS"},
+    {0xFC68, "MIXED_ARABIC_LETTERS"},
+    {0xFC69, "MIXED_ARABIC_LETTERS"},
+    {0xFC6A, "MIXED_ARABIC_LETTERS"},
+    {0xFC6B, "MIXED_ARABIC_LETTERS"},
+    {0xFC6C, "MIXED_ARABIC_LETTERS"},
+    {0xFC6D, "MIXED_ARABIC_LETTERS"},
+    {0xFC6E, "MIXED_ARABIC_LETTERS"},
+    {0xFC6F, "MIXED_ARABIC_LETTERS"},
+    {0xFC70, "MIXED_ARABIC_LETTERS"},
+    {0xFC71, "MIXED_ARABIC_LETTERS"},
+    {0xFC72, "MIXED_ARABIC_LETTERS"},
+    {0xFC73, "MIXED_ARABIC_LETTERS"},
+    {0xFC74, "MIXED_ARABIC_LETTERS"},
+    {0xFC75, "MIXED_ARABIC_LETTERS"},
+    {0xFC76, "MIXED_ARABIC_LETTERS"},
+    {0xFC77, "MIXED_ARABIC_LETTERS"},
+    {0xFC78, "MIXED_ARABIC_LETTERS"},
+    {0xFC79, "MIXED_ARABIC_LETTERS"},
+    {0xFC7A, "MIXED_ARABIC_LETTERS"},
+    {0xFC7B, "MIXED_ARABIC_LETTERS"},
+    {0xFC7C, "MIXED_ARABIC_LETTERS"},
+    {0xFC7D, "MIXED_ARABIC_LETTERS"},
+    {0xFC7E, "MIXED_ARABIC_LETTERS"},
+    {0xFC7F, "MIXED_ARABIC_LETTERS"},
+    {0xFC80, "MIXED_ARABIC_LETTERS"},
+    {0xFC81, "MIXED_ARABIC_LETTERS"},
+    {0xFC82, "MIXED_ARABIC_LETTERS"},
+    {0xFC83, "MIXED_ARABIC_LETTERS"},
+    {0xFC84, "MIXED_ARABIC_LETTERS"},
+    {0xFC85, "MIXED_ARABIC_LETTERS"},
+    {0xFC86, "MIXED_ARABIC_LETTERS"},
+    {0xFC87, "MIXED_ARABIC_LETTERS"},
+    {0xFC88, "MIXED_ARABIC_LETTERS"},
+    {0xFC89, "MIXED_ARABIC_LETTERS"},
+    {0xFC8A, "MIXED_ARABIC_LETTERS"},
+    {0xFC8B, "MIXED_ARABIC_LETTERS"},
+    {0xFC8C, "MIXED_ARABIC_LETTERS"},
+    {0xFC8D, "MIXED_ARABIC_LETTERS"},
+    {0xFC8E, "MIXED_ARABIC_LETTERS"},
+    {0xFC8F, "MIXED_ARABIC_LETTERS"},
+    {0xFC90, "MIXED_ARABIC_LETTERS"},
+    {0xFC91, "MIXED_ARABIC_LETTERS"},
+    {0xFC92, "MIXED_ARABIC_LETTERS"},
+    {0xFC93, "MIXED_ARABIC_LETTERS"},
+    {0xFC94, "MIXED_ARABIC_LETTERS"},
+    {0xFC95, "MIXED_ARABIC_LETTERS"},
+    {0xFC96, "MIXED_ARABIC_LETTERS"},
+    {0xFC97, "MIXED_ARABIC_LETTERS"},
+    {0xFC98, "MIXED_ARABIC_LETTERS"},
+    {0xFC99, "MIXED_ARABIC_LETTERS"},
+    {0xFC9A, "MIXED_ARABIC_LETTERS"},
+    {0xFC9B, "MIXED_ARABIC_LETTERS"},
+    {0xFC9C, "MIXED_ARABIC_LETTERS"},
+    {0xFC9D, "MIXED_ARABIC_LETTERS"},
+    {0xFC9E, "MIXED_ARABIC_LETTERS"},
+    {0xFC9F, "MIXED_ARABIC_LETTERS"},
+    {0xFCA0, "MIXED_ARABIC_LETTERS"},
+    {0xFCA1, "MIXED_ARABIC_LETTERS"},
+    {0xFCA2, "MIXED_ARABIC_LETTERS"},
+    {0xFCA3, "MIXED_ARABIC_LETTERS"},
+    {0xFCA4, "MIXED_ARABIC_LETTERS"},
+    {0xFCA5, "MIXED_ARABIC_LETTERS"},
+    {0xFCA6, "MIXED_ARABIC_LETTERS"},
+    {0xFCA7, "MIXED_ARABIC_LETTERS"},
+    {0xFCA8, "MIXED_ARABIC_LETTERS"},
+    {0xFCA9, "MIXED_ARABIC_LETTERS"},
+    {0xFCAA, "MIXED_ARABIC_LETTERS"},
+    {0xFCAB, "MIXED_ARABIC_LETTERS"},
+    {0xFCAC, "MIXED_ARABIC_LETTERS"},
+    {0xFCAD, "MIXED_ARABIC_LETTERS"},
+    {0xFCAE, "MIXED_ARABIC_LETTERS"},
+    {0xFCAF, "MIXED_ARABIC_LETTERS"},
+    {0xFCB0, "MIXED_ARABIC_LETTERS"},
+    {0xFCB1, "MIXED_ARABIC_LETTERS"},
+    {0xFCB2, "MIXED_ARABIC_LETTERS"},
+    {0xFCB3, "MIXED_ARABIC_LETTERS"},
+    {0xFCB4, "MIXED_ARABIC_LETTERS"},
+    {0xFCB5, "MIXED_ARABIC_LETTERS"},
+    {0xFCB6, "MIXED_ARABIC_LETTERS"},
+    {0xFCB7, "MIXED_ARABIC_LETTERS"},
+    {0xFCB8, "MIXED_ARABIC_LETTERS"},
+    {0xFCB9, "MIXED_ARABIC_LETTERS"},
+    {0xFCBA, "MIXED_ARABIC_LETTERS"},
+    {0xFCBB, "MIXED_ARABIC_LETTERS"},
+    {0xFCBC, "MIXED_ARABIC_LETTERS"},
+    {0xFCBD, "MIXED_ARABIC_LETTERS"},
+    {0xFCBE, "MIXED_ARABIC_LETTERS"},
+    {0xFCBF, "MIXED_ARABIC_LETTERS"},
+    {0xFCC0, "MIXED_ARABIC_LETTERS"},
+    {0xFCC1, "MIXED_ARABIC_LETTERS"},
+    {0xFCC2, "MIXED_ARABIC_LETTERS"},
+    {0xFCC3, "MIXED_ARABIC_LETTERS"},
+    {0xFCC4, "MIXED_ARABIC_LETTERS"},
+    {0xFCC5, "MIXED_ARABIC_LETTERS"},
+    {0xFCC6, "MIXED_ARABIC_LETTERS"},
+    {0xFCC7, "MIXED_ARABIC_LETTERS"},
+    {0xFCC8, "MIXED_ARABIC_LETTERS"},
+    {0xFCC9, "MIXED_ARABIC_LETTERS"},
+    {0xFCCA, "MIXED_ARABIC_LETTERS"},
+    {0xFCCB, "MIXED_ARABIC_LETTERS"},
+    {0xFCCC, "MIXED_ARABIC_LETTERS"},
+    {0xFCCD, "MIXED_ARABIC_LETTERS"},
+    {0xFCCE, "MIXED_ARABIC_LETTERS"},
+    {0xFCCF, "MIXED_ARABIC_LETTERS"},
+    {0xFCD0, "MIXED_ARABIC_LETTERS"},
+    {0xFCD1, "MIXED_ARABIC_LETTERS"},
+    {0xFCD2, "MIXED_ARABIC_LETTERS"},
+    {0xFCD3, "MIXED_ARABIC_LETTERS"},
+    {0xFCD4, "MIXED_ARABIC_LETTERS"},
+    {0xFCD5, "MIXED_ARABIC_LETTERS"},
+    {0xFCD6, "MIXED_ARABIC_LETTERS"},
+    {0xFCD7, "MIXED_ARABIC_LETTERS"},
+    {0xFCD8, "MIXED_ARABIC_LETTERS"},
+    {0xFCD9, "MIXED_ARABIC_LETTERS"},
+    {0xFCDA, "MIXED_ARABIC_LETTERS"},
+    {0xFCDB, "MIXED_ARABIC_LETTERS"},
+    {0xFCDC, "MIXED_ARABIC_LETTERS"},
+    {0xFCDD, "MIXED_ARABIC_LETTERS"},
+    {0xFCDE, "MIXED_ARABIC_LETTERS"},
+    {0xFCDF, "MIXED_ARABIC_LETTERS"},
+    {0xFCE0, "MIXED_ARABIC_LETTERS"},
+    {0xFCE1, "MIXED_ARABIC_LETTERS"},
+    {0xFCE2, "MIXED_ARABIC_LETTERS"},
+    {0xFCE3, "MIXED_ARABIC_LETTERS"},
+    {0xFCE4, "MIXED_ARABIC_LETTERS"},
+    {0xFCE5, "MIXED_ARABIC_LETTERS"},
+    {0xFCE6, "MIXED_ARABIC_LETTERS"},
+    {0xFCE7, "MIXED_ARABIC_LETTERS"},
+    {0xFCE8, "MIXED_ARABIC_LETTERS"},
+    {0xFCE9, "MIXED_ARABIC_LETTERS"},
+    {0xFCEA, "MIXED_ARABIC_LETTERS"},
+    {0xFCEB, "MIXED_ARABIC_LETTERS"},
+    {0xFCEC, "MIXED_ARABIC_LETTERS"},
+    {0xFCED, "MIXED_ARABIC_LETTERS"},
+    {0xFCEE, "MIXED_ARABIC_LETTERS"},
+    {0xFCEF, "MIXED_ARABIC_LETTERS"},
+    {0xFCF0, "MIXED_ARABIC_LETTERS"},
+    {0xFCF1, "MIXED_ARABIC_LETTERS"},
+    {0xFCF2, "MIXED_ARABIC_LETTERS"},
+    {0xFCF3, "MIXED_ARABIC_LETTERS"},
+    {0xFCF4, "MIXED_ARABIC_LETTERS"},
+    {0xFCF5, "MIXED_ARABIC_LETTERS"},
+    {0xFCF6, "MIXED_ARABIC_LETTERS"},
+    {0xFCF7, "MIXED_ARABIC_LETTERS"},
+    {0xFCF8, "MIXED_ARABIC_LETTERS"},
+    {0xFCF9, "MIXED_ARABIC_LETTERS"},
+    {0xFCFA, "MIXED_ARABIC_LETTERS"},
+    {0xFCFB, "MIXED_ARABIC_LETTERS"},
+    {0xFCFC, "MIXED_ARABIC_LETTERS"},
+    {0xFCFD, "MIXED_ARABIC_LETTERS"},
+    {0xFCFE, "MIXED_ARABIC_LETTERS"},
+    {0xFCFF, "MIXED_ARABIC_LETTERS"},
+    {0xFD00, "MIXED_ARABIC_LETTERS"},
+    {0xFD01, "MIXED_ARABIC_LETTERS"},
+    {0xFD02, "MIXED_ARABIC_LETTERS"},
+    {0xFD03, "MIXED_ARABIC_LETTERS"},
+    {0xFD04, "MIXED_ARABIC_LETTERS"},
+    {0xFD05, "MIXED_ARABIC_LETTERS"},
+    {0xFD06, "MIXED_ARABIC_LETTERS"},
+    {0xFD07, "MIXED_ARABIC_LETTERS"},
+    {0xFD08, "MIXED_ARABIC_LETTERS"},
+    {0xFD09, "MIXED_ARABIC_LETTERS"},
+    {0xFD0A, "MIXED_ARABIC_LETTERS"},
+    {0xFD0B, "MIXED_ARABIC_LETTERS"},
+    {0xFD0C, "MIXED_ARABIC_LETTERS"},
+    {0xFD0D, "MIXED_ARABIC_LETTERS"},
+    {0xFD0E, "MIXED_ARABIC_LETTERS"},
+    {0xFD0F, "MIXED_ARABIC_LETTERS"},
+    {0xFD10, "MIXED_ARABIC_LETTERS"},
+    {0xFD11, "MIXED_ARABIC_LETTERS"},
+    {0xFD12, "MIXED_ARABIC_LETTERS"},
+    {0xFD13, "MIXED_ARABIC_LETTERS"},
+    {0xFD14, "MIXED_ARABIC_LETTERS"},
+    {0xFD15, "MIXED_ARABIC_LETTERS"},
+    {0xFD16, "MIXED_ARABIC_LETTERS"},
+    {0xFD17, "MIXED_ARABIC_LETTERS"},
+    {0xFD18, "MIXED_ARABIC_LETTERS"},
+    {0xFD19, "MIXED_ARABIC_LETTERS"},
+    {0xFD1A, "MIXED_ARABIC_LETTERS"},
+    {0xFD1B, "MIXED_ARABIC_LETTERS"},
+    {0xFD1C, "MIXED_ARABIC_LETTERS"},
+    {0xFD1D, "MIXED_ARABIC_LETTERS"},
+    {0xFD1E, "MIXED_ARABIC_LETTERS"},
+    {0xFD1F, "MIXED_ARABIC_LETTERS"},
+    {0xFD20, "MIXED_ARABIC_LETTERS"},
+    {0xFD21, "MIXED_ARABIC_LETTERS"},
+    {0xFD22, "MIXED_ARABIC_LETTERS"},
+    {0xFD23, "MIXED_ARABIC_LETTERS"},
+    {0xFD24, "MIXED_ARABIC_LETTERS"},
+    {0xFD25, "MIXED_ARABIC_LETTERS"},
+    {0xFD26, "MIXED_ARABIC_LETTERS"},
+    {0xFD27, "MIXED_ARABIC_LETTERS"},
+    {0xFD28, "MIXED_ARABIC_LETTERS"},
+    {0xFD29, "MIXED_ARABIC_LETTERS"},
+    {0xFD2A, "MIXED_ARABIC_LETTERS"},
+    {0xFD2B, "MIXED_ARABIC_LETTERS"},
+    {0xFD2C, "MIXED_ARABIC_LETTERS"},
+    {0xFD2D, "MIXED_ARABIC_LETTERS"},
+    {0xFD2E, "MIXED_ARABIC_LETTERS"},
+    {0xFD2F, "MIXED_ARABIC_LETTERS"},
+    {0xFD30, "MIXED_ARABIC_LETTERS"},
+    {0xFD31, "MIXED_ARABIC_LETTERS"},
+    {0xFD32, "MIXED_ARABIC_LETTERS"},
+    {0xFD33, "MIXED_ARABIC_LETTERS"},
+    {0xFD34, "MIXED_ARABIC_LETTERS"},
+    {0xFD35, "MIXED_ARABIC_LETTERS"},
+    {0xFD36, "MIXED_ARABIC_LETTERS"},
+    {0xFD37, "MIXED_ARABIC_LETTERS"},
+    {0xFD38, "MIXED_ARABIC_LETTERS"},
+    {0xFD39, "MIXED_ARABIC_LETTERS"},
+    {0xFD3A, "MIXED_ARABIC_LETTERS"},
+    {0xFD3B, "MIXED_ARABIC_LETTERS"},
+    {0xFD3C, "MIXED_ARABIC_LETTERS"},
+    {0xFD3D, "MIXED_ARABIC_LETTERS"},
+    {0xFD40, "MIXED_ARABIC_LETTERS"},
+    {0xFD41, "MIXED_ARABIC_LETTERS"},
+    {0xFD42, "MIXED_ARABIC_LETTERS"},
+    {0xFD43, "MIXED_ARABIC_LETTERS"},
+    {0xFD44, "MIXED_ARABIC_LETTERS"},
+    {0xFD45, "MIXED_ARABIC_LETTERS"},
+    {0xFD46, "MIXED_ARABIC_LETTERS"},
+    {0xFD47, "MIXED_ARABIC_LETTERS"},
+    {0xFD48, "MIXED_ARABIC_LETTERS"},
+    {0xFD49, "MIXED_ARABIC_LETTERS"},
+    {0xFD4A, "MIXED_ARABIC_LETTERS"},
+    {0xFD4B, "MIXED_ARABIC_LETTERS"},
+    {0xFD4C, "MIXED_ARABIC_LETTERS"},
+    {0xFD4D, "MIXED_ARABIC_LETTERS"},
+    {0xFD4E, "MIXED_ARABIC_LETTERS"},
+    {0xFD4F, "MIXED_ARABIC_LETTERS"},
+    {0xFD50, "MIXED_ARABIC_LETTERS"},
+    {0xFD51, "MIXED_ARABIC_LETTERS"},
+    {0xFD52, "MIXED_ARABIC_LETTERS"},
+    {0xFD53, "MIXED_ARABIC_LETTERS"},
+    {0xFD54, "MIXED_ARABIC_LETTERS"},
+    {0xFD55, "MIXED_ARABIC_LETTERS"},
+    {0xFD56, "MIXED_ARABIC_LETTERS"},
+    {0xFD57, "MIXED_ARABIC_LETTERS"},
+    {0xFD58, "MIXED_ARABIC_LETTERS"},
+    {0xFD59, "MIXED_ARABIC_LETTERS"},
+    {0xFD5A, "MIXED_ARABIC_LETTERS"},
+    {0xFD5B, "MIXED_ARABIC_LETTERS"},
+    {0xFD5C, "MIXED_ARABIC_LETTERS"},
+    {0xFD5D, "MIXED_ARABIC_LETTERS"},
+    {0xFD5E, "MIXED_ARABIC_LETTERS"},
+    {0xFD5F, "MIXED_ARABIC_LETTERS"},
+    {0xFD60, "MIXED_ARABIC_LETTERS"},
+    {0xFD61, "MIXED_ARABIC_LETTERS"},
+    {0xFD62, "MIXED_ARABIC_LETTERS"},
+    {0xFD63, "MIXED_ARABIC_LETTERS"},
+    {0xFD64, "MIXED_ARABIC_LETTERS"},
+    {0xFD65, "MIXED_ARABIC_LETTERS"},
+    {0xFD66, "MIXED_ARABIC_LETTERS"},
+    {0xFD67, "MIXED_ARABIC_LETTERS"},
+    {0xFD68, "MIXED_ARABIC_LETTERS"},
+    {0xFD69, "MIXED_ARABIC_LETTERS"},
+    {0xFD6A, "MIXED_ARABIC_LETTERS"},
+    {0xFD6B, "MIXED_ARABIC_LETTERS"},
+    {0xFD6C, "MIXED_ARABIC_LETTERS"},
+    {0xFD6D, "MIXED_ARABIC_LETTERS"},
+    {0xFD6E, "MIXED_ARABIC_LETTERS"},
+    {0xFD6F, "MIXED_ARABIC_LETTERS"},
+    {0xFD70, "MIXED_ARABIC_LETTERS"},
+    {0xFD71, "MIXED_ARABIC_LETTERS"},
+    {0xFD72, "MIXED_ARABIC_LETTERS"},
+    {0xFD73, "MIXED_ARABIC_LETTERS"},
+    {0xFD74, "MIXED_ARABIC_LETTERS"},
+    {0xFD75, "MIXED_ARABIC_LETTERS"},
+    {0xFD76, "MIXED_ARABIC_LETTERS"},
+    {0xFD77, "MIXED_ARABIC_LETTERS"},
+    {0xFD78, "MIXED_ARABIC_LETTERS"},
+    {0xFD79, "MIXED_ARABIC_LETTERS"},
+    {0xFD7A, "MIXED_ARABIC_LETTERS"},
+    {0xFD7B, "MIXED_ARABIC_LETTERS"},
+    {0xFD7C, "MIXED_ARABIC_LETTERS"},
+    {0xFD7D, "MIXED_ARABIC_LETTERS"},
+    {0xFD7E, "MIXED_ARABIC_LETTERS"},
+    {0xFD7F, "MIXED_ARABIC_LETTERS"},
+    {0xFD80, "MIXED_ARABIC_LETTERS"},
+    {0xFD81, "MIXED_ARABIC_LETTERS"},
+    {0xFD82, "MIXED_ARABIC_LETTERS"},
+    {0xFD83, "MIXED_ARABIC_LETTERS"},
+    {0xFD84, "MIXED_ARABIC_LETTERS"},
+    {0xFD85, "MIXED_ARABIC_LETTERS"},
+    {0xFD86, "MIXED_ARABIC_LETTERS"},
+    {0xFD87, "MIXED_ARABIC_LETTERS"},
+    {0xFD88, "MIXED_ARABIC_LETTERS"},
+    {0xFD89, "MIXED_ARABIC_LETTERS"},
+    {0xFD8A, "MIXED_ARABIC_LETTERS"},
+    {0xFD8B, "MIXED_ARABIC_LETTERS"},
+    {0xFD8C, "MIXED_ARABIC_LETTERS"},
+    {0xFD8D, "MIXED_ARABIC_LETTERS"},
+    {0xFD8E, "MIXED_ARABIC_LETTERS"},
+    {0xFD8F, "MIXED_ARABIC_LETTERS"},
+    {0xFD90, "MIXED_ARABIC_LETTERS"},
+    {0xFD91, "MIXED_ARABIC_LETTERS"},
+    {0xFD92, "MIXED_ARABIC_LETTERS"},
+    {0xFD93, "MIXED_ARABIC_LETTERS"},
+    {0xFD94, "MIXED_ARABIC_LETTERS"},
+    {0xFD95, "MIXED_ARABIC_LETTERS"},
+    {0xFD96, "MIXED_ARABIC_LETTERS"},
+    {0xFD97, "MIXED_ARABIC_LETTERS"},
+    {0xFD98, "MIXED_ARABIC_LETTERS"},
+    {0xFD99, "MIXED_ARABIC_LETTERS"},
+    {0xFD9A, "MIXED_ARABIC_LETTERS"},
+    {0xFD9B, "MIXED_ARABIC_LETTERS"},
+    {0xFD9C, "MIXED_ARABIC_LETTERS"},
+    {0xFD9D, "MIXED_ARABIC_LETTERS"},
+    {0xFD9E, "MIXED_ARABIC_LETTERS"},
+    {0xFD9F, "MIXED_ARABIC_LETTERS"},
+    {0xFDA0, "MIXED_ARABIC_LETTERS"},
+    {0xFDA1, "MIXED_ARABIC_LETTERS"},
+    {0xFDA2, "MIXED_ARABIC_LETTERS"},
+    {0xFDA3, "MIXED_ARABIC_LETTERS"},
+    {0xFDA4, "MIXED_ARABIC_LETTERS"},
+    {0xFDA5, "MIXED_ARABIC_LETTERS"},
+    {0xFDA6, "MIXED_ARABIC_LETTERS"},
+    {0xFDA7, "MIXED_ARABIC_LETTERS"},
+    {0xFDA8, "MIXED_ARABIC_LETTERS"},
+    {0xFDA9, "MIXED_ARABIC_LETTERS"},
+    {0xFDAA, "MIXED_ARABIC_LETTERS"},
+    {0xFDAB, "MIXED_ARABIC_LETTERS"},
+    {0xFDAC, "MIXED_ARABIC_LETTERS"},
+    {0xFDAD, "MIXED_ARABIC_LETTERS"},
+    {0xFDAE, "MIXED_ARABIC_LETTERS"},
+    {0xFDAF, "MIXED_ARABIC_LETTERS"},
+    {0xFDB0, "MIXED_ARABIC_LETTERS"},
+    {0xFDB1, "MIXED_ARABIC_LETTERS"},
+    {0xFDB2, "MIXED_ARABIC_LETTERS"},
+    {0xFDB3, "MIXED_ARABIC_LETTERS"},
+    {0xFDB4, "MIXED_ARABIC_LETTERS"},
+    {0xFDB5, "MIXED_ARABIC_LETTERS"},
+    {0xFDB6, "MIXED_ARABIC_LETTERS"},
+    {0xFDB7, "MIXED_ARABIC_LETTERS"},
+    {0xFDB8, "MIXED_ARABIC_LETTERS"},
+    {0xFDB9, "MIXED_ARABIC_LETTERS"},
+    {0xFDBA, "MIXED_ARABIC_LETTERS"},
+    {0xFDBB, "MIXED_ARABIC_LETTERS"},
+    {0xFDBC, "MIXED_ARABIC_LETTERS"},
+    {0xFDBD, "MIXED_ARABIC_LETTERS"},
+    {0xFDBE, "MIXED_ARABIC_LETTERS"},
+    {0xFDBF, "MIXED_ARABIC_LETTERS"},
+    {0xFDC0, "MIXED_ARABIC_LETTERS"},
+    {0xFDC1, "MIXED_ARABIC_LETTERS"},
+    {0xFDC2, "MIXED_ARABIC_LETTERS"},
+    {0xFDC3, "MIXED_ARABIC_LETTERS"},
+    {0xFDC4, "MIXED_ARABIC_LETTERS"},
+    {0xFDC5, "MIXED_ARABIC_LETTERS"},
+    {0xFDC6, "MIXED_ARABIC_LETTERS"},
+    {0xFDC7, "MIXED_ARABIC_LETTERS"},
+    {0xFDC8, "MIXED_ARABIC_LETTERS"},
+    {0xFDC9, "MIXED_ARABIC_LETTERS"},
+    {0xFDCA, "MIXED_ARABIC_LETTERS"},
+    {0xFDCB, "MIXED_ARABIC_LETTERS"},
+    {0xFDCC, "MIXED_ARABIC_LETTERS"},
+    {0xFDCD, "MIXED_ARABIC_LETTERS"},
+    {0xFDCE, "MIXED_ARABIC_LETTERS"},
+    {0xFDCF, "MIXED_ARABIC_LETTERS"},
+    {0xFDF0, "صلی"},
+    {0xFDF1, "قلی"},
+    {0xFDF2, "الله"},
+    {0xFDF3, "اکبر"},
+    {0xFDF4, "محمد"},
+    {0xFDF5, "صلی"},
+    {0xFDF6, "رسول"},
+    {0xFDF7, "علیه"},
+    {0xFDF8, "وسلم"},
+    {0xFDF9, "صلی"},
+    {0xFDFA, "صلی الله علیه و سلم"},
+    {0xFDFB, "جل جلاله"},
+    {0xFDFD, "سم"},
+    {0xFE81, "آ"},
+    {0xFE82, "ا"},
+    {0xFE83, "أ"},
+    {0xFE84, "أ"},
+    {0xFE85, "ؤ"},
+    {0xFE86, "ؤ"},
+    {0xFE87, "إ"},
+    {0xFE88, "إ"},
+    {0xFE89, "ئ"},
+    {0xFE8A, "ئ"},
+    {0xFE8B, "ئ"},
+    {0xFE8C, "ئ"},
+    {0xFE8D, "ا"},
+    {0xFE8E, "ا"},
+    {0xFE8F, "ب" ARABIC_ZWNJ_UTF8},
+    {0xFE90, "ب" ARABIC_ZWNJ_UTF8},
+    {0xFE91, "ب"},
+    {0xFE92, "ب"},
+    {0xFE93, "ه"},
+    {0xFE94, "ه"},
+    {0xFE95, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFE96, "ت" ARABIC_ZWNJ_UTF8},
+    {0xFE97, "ت"},
+    {0xFE98, "ت"},
+    {0xFE99, "ث" ARABIC_ZWNJ_UTF8},
+    {0xFE9A, "ث" ARABIC_ZWNJ_UTF8},
+    {0xFE9B, "ث"},
+    {0xFE9C, "ث"},
+    {0xFE9D, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFE9E, "ج" ARABIC_ZWNJ_UTF8},
+    {0xFE9F, "ج"},
+    {0xFEA0, "ج"},
+    {0xFEA1, "ح" ARABIC_ZWNJ_UTF8},
+    {0xFEA2, "ح" ARABIC_ZWNJ_UTF8},
+    {0xFEA3, "ح"},
+    {0xFEA4, "ح"},
+    {0xFEA5, "خ" ARABIC_ZWNJ_UTF8},
+    {0xFEA6, "خ" ARABIC_ZWNJ_UTF8},
+    {0xFEA7, "خ"},
+    {0xFEA8, "خ"},
+    {0xFEA9, "د"},
+    {0xFEAA, "د"},
+    {0xFEAB, "ذ"},
+    {0xFEAC, "ذ"},
+    {0xFEAD, "ر"},
+    {0xFEAE, "ر"},
+    {0xFEAF, "ز"},
+    {0xFEB0, "ز"},
+    {0xFEB1, "س" ARABIC_ZWNJ_UTF8},
+    {0xFEB2, "س" ARABIC_ZWNJ_UTF8},
+    {0xFEB3, "س"},
+    {0xFEB4, "س"},
+    {0xFEB5, "ش" ARABIC_ZWNJ_UTF8},
+    {0xFEB6, "ش" ARABIC_ZWNJ_UTF8},
+    {0xFEB7, "ش"},
+    {0xFEB8, "ش"},
+    {0xFEB9, "ص" ARABIC_ZWNJ_UTF8},
+    {0xFEBA, "ص" ARABIC_ZWNJ_UTF8},
+    {0xFEBB, "ص"},
+    {0xFEBC, "ص"},
+    {0xFEBD, "ض" ARABIC_ZWNJ_UTF8},
+    {0xFEBE, "ض" ARABIC_ZWNJ_UTF8},
+    {0xFEBF, "ض"},
+    {0xFEC0, "ض"},
+    {0xFEC1, "ط" ARABIC_ZWNJ_UTF8},
+    {0xFEC2, "ط" ARABIC_ZWNJ_UTF8},
+    {0xFEC3, "ط"},
+    {0xFEC4, "ط"},
+    {0xFEC5, "ظ" ARABIC_ZWNJ_UTF8},
+    {0xFEC6, "ظ" ARABIC_ZWNJ_UTF8},
+    {0xFEC7, "ظ"},
+    {0xFEC8, "ظ"},
+    {0xFEC9, "ع" ARABIC_ZWNJ_UTF8},
+    {0xFECA, "ع" ARABIC_ZWNJ_UTF8},
+    {0xFECB, "ع"},
+    {0xFECC, "ع"},
+    {0xFECD, "غ" ARABIC_ZWNJ_UTF8},
+    {0xFECE, "غ" ARABIC_ZWNJ_UTF8},
+    {0xFECF, "غ"},
+    {0xFED0, "غ"},
+    {0xFED1, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFED2, "ف" ARABIC_ZWNJ_UTF8},
+    {0xFED3, "ف"},
+    {0xFED4, "ف"},
+    {0xFED5, "ق" ARABIC_ZWNJ_UTF8},
+    {0xFED6, "ق" ARABIC_ZWNJ_UTF8},
+    {0xFED7, "ق"},
+    {0xFED8, "ق"},
+    {0xFED9, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFEDA, "ک" ARABIC_ZWNJ_UTF8},
+    {0xFEDB, "ک"},
+    {0xFEDC, "ک"},
+    {0xFEDD, "ل" ARABIC_ZWNJ_UTF8},
+    {0xFEDE, "ل" ARABIC_ZWNJ_UTF8},
+    {0xFEDF, "ل"},
+    {0xFEE0, "ل"},
+    {0xFEE1, "م" ARABIC_ZWNJ_UTF8},
+    {0xFEE2, "م" ARABIC_ZWNJ_UTF8},
+    {0xFEE3, "م"},
+    {0xFEE4, "م"},
+    {0xFEE5, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFEE6, "ن" ARABIC_ZWNJ_UTF8},
+    {0xFEE7, "ن"},
+    {0xFEE8, "ن"},
+    {0xFEE9, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFEEA, "ه" ARABIC_ZWNJ_UTF8},
+    {0xFEEB, "ه"},
+    {0xFEEC, "ه"},
+    {0xFEED, "و"},
+    {0xFEEE, "و"},
+    {0xFEEF, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFEF0, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFEF1, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFEF2, "ی" ARABIC_ZWNJ_UTF8},
+    {0xFEF3, "ی"},
+    {0xFEF4, "ی"},
+    {0xFEF5, "لا"},
+    {0xFEF6, "لا"},
+    {0xFEF7, "لأ"},
+    {0xFEF8, "لأ"},
+    {0xFEF9, "لإ"},
+    {0xFEFA, "لإ"},
+    {0xFEFB, "لا"},
+    {0xFEFC, "لا"}
+};
+static_assert(isSortedByCodePoint(UN_Arabic), "UN_Arabic must be sorted by code point");
+
+/**
+ * @brief Ranges checked by latin2Ascii() when code point is not found in UN_Latin.
+ */
+static constexpr stuUnicodeRange LatinRanges[] = {
+    {0x0080, 0x02AF, nullptr},              // Latin-1 Supplement, Latin Extended-A/B, IPA Extensions
+    {0x0370, 0x03FF, nullptr},              // Greek and Coptic
+    {0x2070, 0x209F, nullptr},              ///@ref http://www.unicode.org/charts/PDF/U2070.pdf
+    {0x2100, 0x214F, nullptr},              // Letterlike Symbols
+    {0x2715, 0x2718, "*"},
+    {0x2719, 0x2725, "+"},
+    {0x2726, 0x274C, "*"},
+    {0x274D, 0x2752, SYMBOL_REMOVED_UTF8},
+    {0x2794, 0x27BE, SYMBOL_REMOVED_UTF8},
+    {0x2C00, 0x2C5F, nullptr},              // Glagolitic
+    {0x2C80, 0x2CFF, nullptr},              // Coptic
+    {0x2D30, 0x2DFF, nullptr},              // Tifinagh
+    {0x3041, 0x312F, nullptr},              // Hiragana & Katakana & Bopomofo
+    {0x3190, 0x319F, SYMBOL_REMOVED_UTF8},
+    {0x31A0, 0x31BF, nullptr},              // Bopomofo Extended
+    {0x31F0, 0x31FF, nullptr},              // Katakana Phonetic Extensions
+    {0x3200, 0x32FF, nullptr},              // Enclosed CJK Letters and Months
+    {0x3400, 0x9FFF, nullptr},              // CJK
+    {0xA000, 0xA48F, nullptr},              // Yi Syllables
+    {0xA800, 0xA82F, nullptr},              // Syloti Nagri
+    {0xA840, 0xA87F, nullptr},              // Phags-pa
+    {0xF900, 0xFAFF, nullptr},              // CJK Compatibility Ideographs
+    {0xFE30, 0xFE4F, nullptr},              // CJK Compatibility Forms
+    {0xFF65, 0xFFDC, nullptr}               // Halfwidth Katakana & Hangul
+};
+static_assert(isSortedByRange(LatinRanges), "LatinRanges must be sorted and must not overlap");
+
+template <size_t N>
+static inline const stuUnicodeNormalization* findNormalization(const stuUnicodeNormalization (&_table)[N], uint _ucs4){
+    const stuUnicodeNormalization* Found = std::lower_bound(
+                _table, _table + N, _ucs4,
+                [](const stuUnicodeNormalization& _item, uint _codePoint){ return _item.CodePoint < _codePoint; });
+    return (Found != _table + N && Found->CodePoint == _ucs4) ? Found : nullptr;
+}
+
+template <size_t N>
+static inline QString unicodeNormalize(uint _ucs4, const stuUnicodeNormalization (&_table)[N], bool _acceptRest = false){
+    const stuUnicodeNormalization* Found = findNormalization(_table, _ucs4);
+    if (Found)
+        return QString::fromUtf8(Found->Normalized);
+    else if (_acceptRest)
+        return QString::fromUcs4(&_ucs4, 1);
+    else
+        return "";
+}
+
+static QString acceptAll(uint _ucs4){
+    return QString::fromUcs4(&_ucs4, 1);
+}
+
+static QString greek2Ascii(uint _ucs4){
+    return unicodeNormalize(_ucs4, UN_Greek, true);
+}
+
+static QString cyrillic2Ascii(uint _ucs4){
+    return unicodeNormalize(_ucs4, UN_Cyrillic, true);
+}
+
+/**
+ * @brief Armenian ligatures are normalized by UN_Latin so rest of Armenian characters are accepted as is.
+ */
+static QString armenina2Ascii(uint _ucs4){
+    return acceptAll(_ucs4);
+}
+
+static QString latin2Ascii(uint _ucs4){
+    ///@ref Supplementary planes: Mathematical alphanumerics are converted to their base form and rest are accepted
+    if (_ucs4 > 0xFFFF){
+        if (QChar::decompositionTag(_ucs4) == QChar::Font)
+            return QChar::decomposition(_ucs4);
+        return QString::fromUcs4(&_ucs4, 1);
+    }
+
+    const stuUnicodeNormalization* Found = findNormalization(UN_Latin, _ucs4);
+    if (Found)
+        return QString::fromUtf8(Found->Normalized);
+
+    const stuUnicodeRange* Range = std::lower_bound(
+                LatinRanges, LatinRanges + sizeof(LatinRanges) / sizeof(LatinRanges[0]), _ucs4,
+                [](const stuUnicodeRange& _range, uint _codePoint){ return _range.Last < _codePoint; });
+    if (Range != LatinRanges + sizeof(LatinRanges) / sizeof(LatinRanges[0]) && Range->First <= _ucs4)
+        return Range->Normalized ? QString::fromUtf8(Range->Normalized) : QString(QChar(_ucs4));
+
+    return "";
+}
+
+static QString arabicNormalizer(uint _ucs4){
+    return unicodeNormalize(_ucs4, UN_Arabic, false);
+}
+
+/**
+ * @brief Name and script based normalizer of each unicode script. Table is indexed by QChar::Script.
+ */
+struct stuScriptInfo{
+    QChar::Script           Script;
+    const char*             Name;
+    ScriptBasedNormalizer   Normalizer;
+};
+
+static constexpr stuScriptInfo ScriptInfoTable[] = {
+    {QChar::Script_Unknown, "Unknown", nullptr},
+    {QChar::Script_Inherited, "Inherited", nullptr},
+    {QChar::Script_Common, "Common", latin2Ascii},
+    {QChar::Script_Latin, "Latin", latin2Ascii},
+    {QChar::Script_Greek, "Greek", greek2Ascii},
+    {QChar::Script_Cyrillic, "Cyrillic", cyrillic2Ascii},
+    {QChar::Script_Armenian, "Armenian", armenina2Ascii},
+    {QChar::Script_Hebrew, "Hebrew", acceptAll},
+    {QChar::Script_Arabic, "Arabic", arabicNormalizer},
+    {QChar::Script_Syriac, "Syriac", acceptAll},
+    {QChar::Script_Thaana, "Thaana", acceptAll},
+    {QChar::Script_Devanagari, "Devanagari", acceptAll},
+    {QChar::Script_Bengali, "Bengali", acceptAll},
+    {QChar::Script_Gurmukhi, "Gurmukhi", acceptAll},
+    {QChar::Script_Gujarati, "Gujarati", acceptAll},
+    {QChar::Script_Oriya, "Oriya", acceptAll},
+    {QChar::Script_Tamil, "Tamil", acceptAll},
+    {QChar::Script_Telugu, "Telugu", acceptAll},
+    {QChar::Script_Kannada, "Kannada", acceptAll},
+    {QChar::Script_Malayalam, "Malayalam", acceptAll},
+    {QChar::Script_Sinhala, "Sinhala", acceptAll},
+    {QChar::Script_Thai, "Thai", acceptAll},
+    {QChar::Script_Lao, "Lao", acceptAll},
+    {QChar::Script_Tibetan, "Tibetan", acceptAll},
+    {QChar::Script_Myanmar, "Myanmar", acceptAll},
+    {QChar::Script_Georgian, "Georgian", acceptAll},
+    {QChar::Script_Hangul, "Hangul", acceptAll},
+    {QChar::Script_Ethiopic, "Ethiopic", nullptr},
+    {QChar::Script_Cherokee, "Cherokee", nullptr},
+    {QChar::Script_CanadianAboriginal, "CanadianAboriginal", nullptr},
+    {QChar::Script_Ogham, "Ogham", acceptAll},
+    {QChar::Script_Runic, "Runic", acceptAll},
+    {QChar::Script_Khmer, "Khmer", acceptAll},
+    {QChar::Script_Mongolian, "Mongolian", nullptr},
+    {QChar::Script_Hiragana, "Hiragana", nullptr},
+    {QChar::Script_Katakana, "Katakana", nullptr},
+    {QChar::Script_Bopomofo, "Bopomofo", nullptr},
+    {QChar::Script_Han, "Han", nullptr},
+    {QChar::Script_Yi, "Yi", nullptr},
+    {QChar::Script_OldItalic, "OldItalic", nullptr},
+    {QChar::Script_Gothic, "Gothic", nullptr},
+    {QChar::Script_Deseret, "Deseret", nullptr},
+    {QChar::Script_Tagalog, "Tagalog", nullptr},
+    {QChar::Script_Hanunoo, "Hanunoo", nullptr},
+    {QChar::Script_Buhid, "Buhid", nullptr},
+    {QChar::Script_Tagbanwa, "Tagbanwa", nullptr},
+    {QChar::Script_Coptic, "Coptic", nullptr},
+    {QChar::Script_Limbu, "Limbu", nullptr},
+    {QChar::Script_TaiLe, "TaiLe", nullptr},
+    {QChar::Script_LinearB, "LinearB", nullptr},
+    {QChar::Script_Ugaritic, "Ugaritic", nullptr},
+    {QChar::Script_Shavian, "Shavian", nullptr},
+    {QChar::Script_Osmanya, "Osmanya", nullptr},
+    {QChar::Script_Cypriot, "Cypriot", nullptr},
+    {QChar::Script_Braille, "Braille", acceptAll},
+    {QChar::Script_Buginese, "Buginese", nullptr},
+    {QChar::Script_NewTaiLue, "NewTaiLue", nullptr},
+    {QChar::Script_Glagolitic, "Glagolitic", nullptr},
+    {QChar::Script_Tifinagh, "Tifinagh", nullptr},
+    {QChar::Script_SylotiNagri, "SylotiNagri", nullptr},
+    {QChar::Script_OldPersian, "OldPersian", nullptr},
+    {QChar::Script_Kharoshthi, "Kharoshthi", nullptr},
+    {QChar::Script_Balinese, "Balinese", nullptr},
+    {QChar::Script_Cuneiform, "Cuneiform", nullptr},
+    {QChar::Script_Phoenician, "Phoenician", nullptr},
+    {QChar::Script_PhagsPa, "PhagsPa", nullptr},
+    {QChar::Script_Nko, "Nko", acceptAll},
+    {QChar::Script_Sundanese, "Sundanese", nullptr},
+    {QChar::Script_Lepcha, "Lepcha", nullptr},
+    {QChar::Script_OlChiki, "OlChiki", nullptr},
+    {QChar::Script_Vai, "Vai", nullptr},
+    {QChar::Script_Saurashtra, "Saurashtra", nullptr},
+    {QChar::Script_KayahLi, "KayahLi", nullptr},
+    {QChar::Script_Rejang, "Rejang", nullptr},
+    {QChar::Script_Lycian, "Lycian", nullptr},
+    {QChar::Script_Carian, "Carian", nullptr},
+    {QChar::Script_Lydian, "Lydian", nullptr},
+    {QChar::Script_Cham, "Cham", nullptr},
+    {QChar::Script_TaiTham, "TaiTham", nullptr},
+    {QChar::Script_TaiViet, "TaiViet", nullptr},
+    {QChar::Script_Avestan, "Avestan", nullptr},
+    {QChar::Script_EgyptianHieroglyphs, "EgyptianHieroglyphs", nullptr},
+    {QChar::Script_Samaritan, "Samaritan", nullptr},
+    {QChar::Script_Lisu, "Lisu", nullptr},
+    {QChar::Script_Bamum, "Bamum", nullptr},
+    {QChar::Script_Javanese, "Javanese", nullptr},
+    {QChar::Script_MeeteiMayek, "MeeteiMayek", nullptr},
+    {QChar::Script_ImperialAramaic, "ImperialAramaic", nullptr},
+    {QChar::Script_OldSouthArabian, "OldSouthArabian", nullptr},
+    {QChar::Script_InscriptionalParthian, "InscriptionalParthian", nullptr},
+    {QChar::Script_InscriptionalPahlavi, "InscriptionalPahlavi", nullptr},
+    {QChar::Script_OldTurkic, "OldTurkic", nullptr},
+    {QChar::Script_Kaithi, "Kaithi", nullptr},
+    {QChar::Script_Batak, "Batak", nullptr},
+    {QChar::Script_Brahmi, "Brahmi", nullptr},
+    {QChar::Script_Mandaic, "Mandaic", nullptr},
+    {QChar::Script_Chakma, "Chakma", nullptr},
+    {QChar::Script_MeroiticCursive, "MeroiticCursive", nullptr},
+    {QChar::Script_MeroiticHieroglyphs, "MeroiticHieroglyphs", nullptr},
+    {QChar::Script_Miao, "Miao", nullptr},
+    {QChar::Script_Sharada, "Sharada", nullptr},
+    {QChar::Script_SoraSompeng, "SoraSompeng", nullptr},
+    {QChar::Script_Takri, "Takri", nullptr}
+};
+
+template <size_t N>
+constexpr bool isIndexedByScript(const stuScriptInfo (&_table)[N]){
+    for (size_t i = 0; i < N; ++i)
+        if (static_cast<size_t>(_table[i].Script) != i)
+            return false;
+    return true;
+}
+static_assert(isIndexedByScript(ScriptInfoTable), "ScriptInfoTable must be in order of QChar::Script");
+
+/**
+ * @brief Names of unicode categories which are reported in interactive mode. Table is indexed by QChar::Category.
+ */
+struct stuCategoryInfo{
+    QChar::Category         Category;
+    const char*             Name;
+};
+
+static constexpr stuCategoryInfo CategoryInfoTable[] = {
+    {QChar::Mark_NonSpacing, "QChar::Mark_NonSpacing"},
+    {QChar::Mark_SpacingCombining, "QChar::Mark_SpacingCombining"},
+    {QChar::Mark_Enclosing, "QChar::Mark_Enclosing"},
+    {QChar::Number_DecimalDigit, "QChar::Number_DecimalDigit"},
+    {QChar::Number_Letter, "QChar::Number_Letter"},
+    {QChar::Number_Other, "QChar::Number_Other"},
+    {QChar::Separator_Space, "QChar::Separator_Space"},
+    {QChar::Separator_Line, "QChar::Separator_Line"},
+    {QChar::Separator_Paragraph, "QChar::Separator_Paragraph"},
+    {QChar::Other_Control, "QChar::Other_Control"},
+    {QChar::Other_Format, "QChar::Other_Format"},
+    {QChar::Other_Surrogate, "QChar::Other_Surrogate"},
+    {QChar::Other_PrivateUse, "QChar::Other_PrivateUse"},
+    {QChar::Other_NotAssigned, "QChar::Other_NotAssigned"}
+};
+
+template <size_t N>
+constexpr bool isIndexedByCategory(const stuCategoryInfo (&_table)[N]){
+    for (size_t i = 0; i < N; ++i)
+        if (static_cast<size_t>(_table[i].Category) != i)
+            return false;
+    return true;
+}
+static_assert(isIndexedByCategory(CategoryInfoTable), "CategoryInfoTable must be in order of QChar::Category");
+
+ScriptBasedNormalizer scriptBasedNormalizer(QChar::Script _script)
+{
+    return static_cast<size_t>(_script) < sizeof(ScriptInfoTable) / sizeof(ScriptInfoTable[0]) ?
+                ScriptInfoTable[_script].Normalizer : nullptr;
+}
+
+const char* scriptName(QChar::Script _script)
+{
+    return static_cast<size_t>(_script) < sizeof(ScriptInfoTable) / sizeof(ScriptInfoTable[0]) ?
+                ScriptInfoTable[_script].Name : "";
+}
+
+const char* categoryName(QChar::Category _category)
+{
+    return static_cast<size_t>(_category) < sizeof(CategoryInfoTable) / sizeof(CategoryInfoTable[0]) ?
+                CategoryInfoTable[_category].Name : "";
+}
+
+}
+}
+}
+}
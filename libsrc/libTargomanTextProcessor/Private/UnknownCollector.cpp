@@ -0,0 +1,262 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QSaveFile>
+#include <QHash>
+#include <algorithm>
+
+#include "UnknownCollector.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+/**
+ * @brief Releases shard of a thread when the thread finishes so it can be adopted by another thread.
+ */
+struct stuShardOwnership{
+    std::atomic<bool>* Owned = nullptr;
+    ~stuShardOwnership(){
+        if (this->Owned)
+            this->Owned->store(false, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief 64 bit FNV-1a hash of token and its language. Top bit is always set so token keys never collide with
+ * character keys which are code point plus one.
+ */
+static inline quint64 tokenKey(const QString& _lang, const QString& _token)
+{
+    quint64 Hash = Q_UINT64_C(14695981039346656037);
+    for (const QChar& Char : _lang)
+        Hash = (Hash ^ Char.unicode()) * Q_UINT64_C(1099511628211);
+    Hash = (Hash ^ 0xFFFF) * Q_UINT64_C(1099511628211);
+    for (const QChar& Char : _token)
+        Hash = (Hash ^ Char.unicode()) * Q_UINT64_C(1099511628211);
+    return Hash | (Q_UINT64_C(1) << 63);
+}
+
+UnknownCollector::UnknownCollector() :
+    Active(false)
+{}
+
+/**
+ * @brief returns shard owned by current thread. A free shard is adopted or a new one is created on first call of
+ * each thread; next calls do not lock.
+ */
+UnknownCollector::stuShard *UnknownCollector::threadShard()
+{
+    thread_local stuShard*         Shard = nullptr;
+    thread_local stuShardOwnership Ownership;
+    if (Q_LIKELY(Shard))
+        return Shard;
+
+    QMutexLocker Locker(&this->ShardsLock);
+    foreach (stuShard* FreeShard, this->Shards){
+        bool Expected = false;
+        if (FreeShard->Owned.compare_exchange_strong(Expected, true, std::memory_order_acquire)){
+            Shard = FreeShard;
+            break;
+        }
+    }
+    if (Shard == nullptr){
+        Shard = new stuShard;
+        Shard->Owned.store(true, std::memory_order_relaxed);
+        Shard->Dropped.store(0, std::memory_order_relaxed);
+        for (stuSlot& Slot : Shard->Slots){
+            Slot.Key.store(0, std::memory_order_relaxed);
+            Slot.Count.store(0, std::memory_order_relaxed);
+            Slot.Sample.store(nullptr, std::memory_order_relaxed);
+        }
+        this->Shards.append(Shard);
+    }
+    Ownership.Owned = &Shard->Owned;
+    return Shard;
+}
+
+/**
+ * @brief Finds slot of a key or an empty slot to insert it using linear probing. Must only be called by owner of shard.
+ * @return found slot or nullptr if shard is too crowded around key.
+ */
+UnknownCollector::stuSlot *UnknownCollector::findSlot(stuShard *_shard, quint64 _key)
+{
+    quint64 Hash = _key * Q_UINT64_C(0x9E3779B97F4A7C15);
+    size_t Index = static_cast<size_t>(Hash >> 32) % UNKNOWN_COLLECTOR_SHARD_SIZE;
+    for (int Probe = 0; Probe < UNKNOWN_COLLECTOR_MAX_PROBES; ++Probe){
+        stuSlot* Slot = &_shard->Slots[Index];
+        quint64 SlotKey = Slot->Key.load(std::memory_order_relaxed);
+        if (SlotKey == _key || SlotKey == 0)
+            return Slot;
+        Index = (Index + 1) % UNKNOWN_COLLECTOR_SHARD_SIZE;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Records an unresolved character.
+ * @param _codePoint unresolved code point
+ * @param _data buffer which contains the character. It is only read when character is seen for first time.
+ * @param _size size of buffer
+ * @param _pos position of character in buffer
+ */
+void UnknownCollector::recordCharacter(uint _codePoint, const QChar *_data, int _size, int _pos)
+{
+    stuShard* Shard = this->threadShard();
+    quint64 Key = static_cast<quint64>(_codePoint) + 1;
+    stuSlot* Slot = findSlot(Shard, Key);
+    if (Slot == nullptr){
+        Shard->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (Slot->Key.load(std::memory_order_relaxed)){
+        Slot->Count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    int Start = qMax(0, _pos - UNKNOWN_COLLECTOR_SAMPLE_WINDOW);
+    int End = qMin(_size, _pos + UNKNOWN_COLLECTOR_SAMPLE_WINDOW);
+    Slot->Sample.store(new stuSample{enuUnknownType::Character,
+                                     QString(),
+                                     QString::fromUcs4(&_codePoint, 1),
+                                     _codePoint,
+                                     QString(_data + Start, End - Start)},
+                       std::memory_order_relaxed);
+    Slot->Count.store(1, std::memory_order_relaxed);
+    Slot->Key.store(Key, std::memory_order_release);
+}
+
+/**
+ * @brief Records a token which spell corrector could neither accept nor correct.
+ * @param _lang language of spell corrector
+ * @param _token suspicious token
+ * @param _phrase phrase containing the token. It is only read when token is seen for first time.
+ */
+void UnknownCollector::recordToken(const QString &_lang, const QString &_token, const QString &_phrase)
+{
+    stuShard* Shard = this->threadShard();
+    quint64 Key = tokenKey(_lang, _token);
+    stuSlot* Slot = findSlot(Shard, Key);
+    if (Slot == nullptr){
+        Shard->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (Slot->Key.load(std::memory_order_relaxed)){
+        Slot->Count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    int Pos = qMax(0, _phrase.indexOf(_token));
+    int Start = qMax(0, Pos - UNKNOWN_COLLECTOR_SAMPLE_WINDOW);
+    int End = qMin(_phrase.size(), Pos + _token.size() + UNKNOWN_COLLECTOR_SAMPLE_WINDOW);
+    Slot->Sample.store(new stuSample{enuUnknownType::Token, _lang, _token, 0, _phrase.mid(Start, End - Start)},
+                       std::memory_order_relaxed);
+    Slot->Count.store(1, std::memory_order_relaxed);
+    Slot->Key.store(Key, std::memory_order_release);
+}
+
+/**
+ * @brief Merges entries of all shards.
+ * @param _reset if true, counters will be reset so next call only reports new occurrences. Samples are kept.
+ * @return collected entries sorted by number of occurrences.
+ */
+QList<stuUnknownEntry> UnknownCollector::entries(bool _reset)
+{
+    QHash<quint64, stuUnknownEntry> Merged;
+    QMutexLocker Locker(&this->ShardsLock);
+    foreach (stuShard* Shard, this->Shards){
+        for (stuSlot& Slot : Shard->Slots){
+            quint64 Key = Slot.Key.load(std::memory_order_acquire);
+            if (Key == 0)
+                continue;
+            quint64 Count = _reset ? Slot.Count.exchange(0, std::memory_order_relaxed) :
+                                     Slot.Count.load(std::memory_order_relaxed);
+            if (Count == 0)
+                continue;
+            auto Entry = Merged.find(Key);
+            if (Entry == Merged.end()){
+                const stuSample* Sample = Slot.Sample.load(std::memory_order_acquire);
+                Merged.insert(Key, stuUnknownEntry{Sample->Type,
+                                                   Sample->Lang,
+                                                   Sample->Key,
+                                                   Sample->CodePoint,
+                                                   Sample->Context,
+                                                   Count});
+            }else
+                Entry->Count += Count;
+        }
+    }
+    Locker.unlock();
+
+    QList<stuUnknownEntry> Entries = Merged.values();
+    std::stable_sort(Entries.begin(), Entries.end(), [](const stuUnknownEntry& _first, const stuUnknownEntry& _second){
+        return _first.Count > _second.Count;
+    });
+    return Entries;
+}
+
+/**
+ * @brief Writes collected entries to a tab separated UTF-8 file: type, language, key, code point, count and sample.
+ * @exception throws exception if output file can not be written.
+ */
+void UnknownCollector::dump(const QString &_filePath, bool _reset)
+{
+    QSaveFile File(_filePath);
+    if (!File.open(QIODevice::WriteOnly))
+        throw exUnknownCollector("Unable to open <" + _filePath + "> to dump unknowns");
+
+    foreach (const stuUnknownEntry& Entry, this->entries(_reset)){
+        QString Sample = Entry.Sample;
+        Sample.replace('\t', ' ').replace('\n', ' ');
+        File.write(QString("%1\t%2\t%3\t%4\t%5\t%6\n").arg(
+                       enuUnknownType::toStr(Entry.Type)).arg(
+                       Entry.Lang).arg(
+                       Entry.Key).arg(
+                       Entry.CodePoint ? QString("0x%1").arg(Entry.CodePoint, 0, 16).toUpper() : QString()).arg(
+                       Entry.Count).arg(
+                       Sample).toUtf8());
+    }
+    if (!File.commit())
+        throw exUnknownCollector("Unable to write unknowns to <" + _filePath + ">");
+}
+
+/**
+ * @brief returns number of occurrences which were not recorded because their shard was full.
+ */
+quint64 UnknownCollector::dropped() const
+{
+    quint64 Dropped = 0;
+    QMutexLocker Locker(&this->ShardsLock);
+    foreach (stuShard* Shard, this->Shards)
+        Dropped += Shard->Dropped.load(std::memory_order_relaxed);
+    return Dropped;
+}
+
+}
+}
+}
+}
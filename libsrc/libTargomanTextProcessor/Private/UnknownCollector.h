@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#ifndef TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_UNKNOWNCOLLECTOR_H
+#define TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_UNKNOWNCOLLECTOR_H
+
+#include <atomic>
+#include <QList>
+#include <QMutex>
+#include <QString>
+
+#include "../TextProcessor.h"
+
+namespace Targoman {
+namespace NLPLibs {
+namespace TargomanTP{
+namespace Private {
+
+TARGOMAN_ADD_EXCEPTION_HANDLER(exUnknownCollector, exTextProcessor);
+
+TARGOMAN_DEFINE_ENHANCED_ENUM(enuUnknownType,
+                              Character,
+                              Token
+                              );
+
+/**
+ * @brief An unresolved character or a suspicious token collected from processed texts.
+ */
+struct stuUnknownEntry{
+    enuUnknownType::Type Type;
+    QString Lang;                                       /** < Language of spell corrector which found the token.*/
+    QString Key;                                        /** < Unresolved character or suspicious token.*/
+    uint    CodePoint;                                  /** < Code point of unresolved character, 0 for tokens.*/
+    QString Sample;                                     /** < Context of first occurrence.*/
+    quint64 Count;                                      /** < Number of occurrences.*/
+};
+
+#define UNKNOWN_COLLECTOR_SHARD_SIZE    4096
+#define UNKNOWN_COLLECTOR_MAX_PROBES    64
+#define UNKNOWN_COLLECTOR_SAMPLE_WINDOW 24
+
+/**
+ * @brief The UnknownCollector class records unresolved characters and suspicious tokens instead of asking user about
+ * them, so that they can be curated offline.
+ *
+ * Each thread records to its own shard which is a fixed size open addressing table, so recording takes no lock and
+ * only allocates when an entry is seen for first time. Shards of finished threads are adopted by new threads.
+ * entries() and dump() merge all shards and can be called while texts are being processed.
+ */
+class UnknownCollector
+{
+public:
+    static UnknownCollector& instance(){
+        // Initialization of a local static is thread safe. Collector is never destroyed as records may come from any
+        // caller thread, including destructors of thread_local objects which run during process exit
+        static UnknownCollector* Instance = new UnknownCollector;
+        return *Instance;
+    }
+
+    inline bool isActive() const {return this->Active.load(std::memory_order_relaxed);}
+    inline void setActive(bool _active) {this->Active.store(_active, std::memory_order_relaxed);}
+
+    void recordCharacter(uint _codePoint, const QChar* _data, int _size, int _pos);
+    void recordToken(const QString& _lang, const QString& _token, const QString& _phrase);
+
+    QList<stuUnknownEntry> entries(bool _reset = false);
+    void dump(const QString& _filePath, bool _reset = false);
+    quint64 dropped() const;
+
+private:
+    struct stuSample{
+        enuUnknownType::Type Type;
+        QString Lang;
+        QString Key;
+        uint    CodePoint;
+        QString Context;
+    };
+
+    struct stuSlot{
+        std::atomic<quint64>    Key;                    /** < 0 for empty slots. Only written by owner of shard.*/
+        std::atomic<quint64>    Count;
+        std::atomic<stuSample*> Sample;                 /** < Written once before Key is published.*/
+    };
+
+    struct stuShard{
+        std::atomic<bool>       Owned;
+        std::atomic<quint64>    Dropped;                /** < Occurrences which could not be recorded as shard was full.*/
+        stuSlot                 Slots[UNKNOWN_COLLECTOR_SHARD_SIZE];
+    };
+
+private:
+    UnknownCollector();
+    Q_DISABLE_COPY(UnknownCollector)
+
+    stuShard* threadShard();
+    static stuSlot* findSlot(stuShard* _shard, quint64 _key);
+
+private:
+    std::atomic<bool>   Active;                         /** < Whether unknowns must be recorded or not.*/
+    QList<stuShard*>    Shards;                         /** < All shards. Shards are never freed.*/
+    mutable QMutex      ShardsLock;                     /** < Guards Shards list. It is not taken when recording to an owned shard.*/
+};
+
+}
+}
+}
+}
+
+#endif // TARGOMAN_NLPLIBS_TARGOMANTP_PRIVATE_UNKNOWNCOLLECTOR_H
@@ -29,10 +29,19 @@
 #include "Private/Normalizer.h"
 #include "Private/SpellCorrector.h"
 #include "Private/IXMLWriter.h"
+#include "Private/IXMLReader.h"
+#include "Private/IXMLReplacementSet.h"
+#include "Private/RulesSnapshot.h"
+#include "Private/UnknownCollector.h"
+#include "Private/PipelineStats.h"
+#include "Private/BatchProcessor.h"
+#include "Private/StreamProcessor.h"
 #include "Private/Configs.h"
 #include <QSettings>
-#include <QRegularExpression>
-#include <QRegularExpressionMatch>
+#include <QFile>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <atomic>
 
 using namespace Targoman::NLPLibs::TargomanTP::Private;
 
@@ -41,7 +50,38 @@ using namespace Targoman::NLPLibs::TargomanTP::Private;
 namespace Targoman {
 namespace NLPLibs {
 
-static bool Initialized = false;
+static QMutex                       ReloadLock;              /**< Serializes init() and reload() calls.*/
+static TargomanTextProcessor::stuConfigs LoadedConfigs;     /**< Configs of last loaded rules, used by reload().*/
+static std::atomic<qint64>          LastReloadDuration(0);  /**< Time spent on loading last published rules in milliseconds.*/
+
+/**
+ * @brief returns current rules snapshot.
+ * @exception throws exception if text processor has not been initialized.
+ */
+static inline RulesSnapshot::Ptr_t currentRules()
+{
+    RulesSnapshot::Ptr_t Rules = RulesSnapshot::current();
+    if (Q_UNLIKELY(!Rules))
+        throw exTextProcessor("Text Processor has not been initialized");
+    return Rules;
+}
+
+/**
+ * @brief loads all rules from scratch and publishes them. ReloadLock must be held by caller.
+ */
+static void loadRules(const TargomanTextProcessor::stuConfigs &_configs)
+{
+    QElapsedTimer Timer;
+    Timer.start();
+
+    RulesSnapshot::Ptr_t Snapshot = RulesSnapshot::load(_configs);
+    RulesSnapshot::publish(Snapshot);
+    LoadedConfigs = _configs;
+    qint64 Duration = Timer.elapsed();
+    LastReloadDuration.store(Duration);
+
+    TargomanLogInfo(5, QString("Rules version %1 loaded in %2 ms").arg(Snapshot->version()).arg(Duration));
+}
 
 /**
  * @brief TextProcessor::TextProcessor
@@ -56,23 +96,176 @@ TargomanTextProcessor::TargomanTextProcessor()
  */
 bool TargomanTextProcessor::init(const stuConfigs& _configs)
 {
-    if (Initialized)
+    // Checked under lock so that concurrent calls load rules only once
+    QMutexLocker Locker(&ReloadLock);
+    if (RulesSnapshot::current())
         return true;
-    Normalizer::instance().init(_configs.NormalizationFile);
-    SpellCorrector::instance().init(_configs.SpellCorrectorBaseConfigPath, _configs.SpellCorrectorLanguageBasedConfigs);
-    IXMLWriter::instance().init(_configs.AbbreviationsFile);
     ISO639init();
-    Initialized = true;
+    loadRules(_configs);
+    return true;
+}
+
+/**
+ * @brief TextProcessor::reload Reloads rules using configs which were used by last init() or reload().
+ * @return
+ */
+bool TargomanTextProcessor::reload()
+{
+    stuConfigs Configs;
+    {
+        QMutexLocker Locker(&ReloadLock);
+        if (!RulesSnapshot::current())
+            throw exTextProcessor("Text Processor has not been initialized");
+        Configs = LoadedConfigs;
+    }
+    return this->reload(Configs);
+}
+
+/**
+ * @brief TextProcessor::reload Loads all rules from scratch and replaces current rules when loading is finished.
+ * Running requests are not blocked while loading and finish with rules they have started with. If loading fails,
+ * current rules are kept and exception is rethrown.
+ * @param _configs
+ * @return
+ */
+bool TargomanTextProcessor::reload(const stuConfigs &_configs)
+{
+    QMutexLocker Locker(&ReloadLock);
+    loadRules(_configs);
     return true;
 }
 
+/**
+ * @brief TextProcessor::rulesVersion
+ * @return version of rules in use. It is increased on each reload and is 0 before init().
+ */
+quint64 TargomanTextProcessor::rulesVersion() const
+{
+    RulesSnapshot::Ptr_t Rules = RulesSnapshot::current();
+    return Rules ? Rules->version() : 0;
+}
+
+/**
+ * @brief TextProcessor::lastReloadDuration
+ * @return time spent on loading rules in use, in milliseconds.
+ */
+qint64 TargomanTextProcessor::lastReloadDuration() const
+{
+    return LastReloadDuration.load();
+}
+
+/**
+ * @brief TextProcessor::setCollectUnknowns Enables or disables collecting unresolved characters and suspicious tokens
+ * in non-interactive mode. Collected entries are kept when collection is disabled.
+ */
+void TargomanTextProcessor::setCollectUnknowns(bool _active)
+{
+    UnknownCollector::instance().setActive(_active);
+}
+
+/**
+ * @brief TextProcessor::collectedUnknowns
+ * @param _reset if true, occurrence counters will be reset after being reported.
+ * @return list of collected unknowns sorted by number of occurrences. Each item is a map containing type, lang,
+ * key, codePoint, count and sample.
+ */
+QVariantList TargomanTextProcessor::collectedUnknowns(bool _reset) const
+{
+    QVariantList Unknowns;
+    foreach (const stuUnknownEntry& Entry, UnknownCollector::instance().entries(_reset)){
+        QVariantMap Unknown;
+        Unknown.insert("type", enuUnknownType::toStr(Entry.Type));
+        Unknown.insert("lang", Entry.Lang);
+        Unknown.insert("key", Entry.Key);
+        Unknown.insert("codePoint", Entry.CodePoint);
+        Unknown.insert("count", Entry.Count);
+        Unknown.insert("sample", Entry.Sample);
+        Unknowns.append(Unknown);
+    }
+    return Unknowns;
+}
+
+/**
+ * @brief TextProcessor::dumpCollectedUnknowns writes collected unknowns as a tab separated file.
+ * @param _filePath path of output file.
+ * @param _reset if true, occurrence counters will be reset after being written.
+ */
+void TargomanTextProcessor::dumpCollectedUnknowns(const QString &_filePath, bool _reset) const
+{
+    UnknownCollector::instance().dump(_filePath, _reset);
+}
+
+/**
+ * @brief TextProcessor::compactLearnedRules Folds rules learned in interactive mode, which are kept in append-only
+ * journals, into normalization and spell corrector config files.
+ */
+void TargomanTextProcessor::compactLearnedRules() const
+{
+    RulesSnapshot::Ptr_t Rules = currentRules();
+    Rules->normalizer().compactLearnedRules();
+    Rules->spellCorrector().compactLearnedRules();
+}
+
+/**
+ * @brief TextProcessor::setPipelineProfiling Enables or disables collecting time and number of matches of each stage
+ * of text2IXML pipeline. Collected counters are kept when profiling is disabled.
+ */
+void TargomanTextProcessor::setPipelineProfiling(bool _active)
+{
+    PipelineStats::instance().setActive(_active);
+}
+
+/**
+ * @brief TextProcessor::pipelineStats
+ * @param _reset if true, counters will be reset after being reported.
+ * @return counters of stages in their order in pipeline.
+ */
+QList<stuPipelineStageStats> TargomanTextProcessor::pipelineStats(bool _reset) const
+{
+    return PipelineStats::instance().stats(_reset);
+}
+
+/**
+ * @brief compiles a list of replacements once, so that it can be passed to text2IXML() by the returned handle instead
+ * of being copied and compiled on each call. Replacements are applied in their order as with _replacements.
+ * @return handle of registered set which is never 0.
+ * @exception throws exTextProcessor if a pattern is invalid.
+ */
+quint32 TargomanTextProcessor::registerReplacements(const QList<stuIXMLReplacement> &_replacements)
+{
+    return IXMLReplacementSet::add(_replacements);
+}
+
+/**
+ * @brief unregisters a replacement set. Calls which are already using it finish with it.
+ * @return false if handle was not registered.
+ */
+bool TargomanTextProcessor::unregisterReplacements(quint32 _handle)
+{
+    return IXMLReplacementSet::remove(_handle);
+}
+
+/**
+ * @brief sets number of threads used by text2IXMLBatch() and ixml2TextBatch(). Values less than 1 use one thread per
+ * core, which is the default.
+ */
+void TargomanTextProcessor::setBatchThreadCount(int _count)
+{
+    BatchProcessor::instance().setThreadCount(_count);
+}
+
+int TargomanTextProcessor::batchThreadCount() const
+{
+    return BatchProcessor::instance().threadCount();
+}
+
 /**
  * @brief TextProcessor::init Initialization method used in combination with TargomanStyle configurations
  * @return
  */
 bool TargomanTextProcessor::init(QSharedPointer<QSettings> _configSettings)
 {
-    if (Initialized)
+    if (RulesSnapshot::current())
         return true;
 
     stuConfigs MyConfigs;
@@ -96,39 +289,37 @@ bool TargomanTextProcessor::init(QSharedPointer<QSettings> _configSettings)
 }
 
 /**
- * @brief TextProcessor::text2IXML
- * @param _inStr
- * @param _interactive
- * @param _useSpellCorrector
- * @param _removingTags
- * @return
+ * @brief converts input text to ixml using current rules. Tags are stored in _tags if it is provided.
  */
-QString TargomanTextProcessor::text2IXML(const QString &_inStr,
-                                         INOUT bool& _spellCorrected,
-                                         const QString& _lang,
-                                         quint32 _lineNo,
-                                         bool _interactive,
-                                         bool _useSpellCorrector,                              
-                                         QList<enuTextTags::Type> _removingTags,
-                                         QList<stuIXMLReplacement> _replacements,
-                                         bool _putXmlTagsInSeperateList,
-                                         QVariantList* _lstXmlTags,
-                                         bool _setTagValue,
-                                         bool _convertToLower,
-                                         bool _detectSymbols,
-                                         bool _setTagIndex) const
+static QString convertText2IXML(const QString &_inStr,
+                                bool& _spellCorrected,
+                                stuIXMLTagList* _tags,
+                                const QString& _lang,
+                                quint32 _lineNo,
+                                bool _interactive,
+                                bool _useSpellCorrector,
+                                const QList<enuTextTags::Type>& _removingTags,
+                                const QList<stuIXMLReplacement>& _replacements,
+                                bool _setTagValue,
+                                bool _convertToLower,
+                                bool _detectSymbols,
+                                bool _setTagIndex,
+                                QVector<stuTextAlignment>* _alignment,
+                                bool _detectRemovedTags,
+                                quint32 _replacementSet)
 {
-    if (!Initialized)
-        throw exTextProcessor("Text Processor has not been initialized");
+    RulesSnapshot::Ptr_t Rules = currentRules();
+    IXMLReplacementSet::Ptr_t ReplacementSet;
+    if (_replacementSet && (ReplacementSet = IXMLReplacementSet::find(_replacementSet)).isNull())
+        throw exTextProcessor(QString("Replacement set %1 is not registered").arg(_replacementSet));
     TargomanDebug(7,"ConvertToIXML Process Started");
 
     const char* LangCode = ISO639getAlpha2(_lang.toLatin1().constData());
 
-    QString IXML = IXMLWriter::instance().convert2IXML(
+    QString IXML = Rules->ixmlWriter().convert2IXML(
                        _inStr,
                        _spellCorrected,
-                       _putXmlTagsInSeperateList && _lstXmlTags,
-                       _lstXmlTags,
+                       _tags,
                        _removingTags,
                        LangCode ? LangCode : "",
                        _lineNo,
@@ -137,8 +328,12 @@ QString TargomanTextProcessor::text2IXML(const QString &_inStr,
                        _setTagValue,
                        _convertToLower,
                        _detectSymbols,
-                       _setTagIndex);
+                       _setTagIndex,
+                       _alignment,
+                       _detectRemovedTags);
 
+    if (ReplacementSet)
+        ReplacementSet->apply(IXML);
     foreach(const stuIXMLReplacement& Replacement, _replacements)
         IXML.replace(Replacement.SearchRegExp, Replacement.AfterString);
 
@@ -152,60 +347,384 @@ QString TargomanTextProcessor::text2IXML(const QString &_inStr,
     return IXML;
 }
 
+/**
+ * @brief TextProcessor::text2IXML
+ * @param _inStr
+ * @param _interactive
+ * @param _useSpellCorrector
+ * @param _removingTags
+ * @param _putXmlTagsInSeperateList if true, tags are stored in _lstXmlTags as maps of tag ("t") and value ("v").
+ * Use the overload with stuIXMLTagList to avoid building a map per tag.
+ * @param _alignment if provided, it will be filled with span of input text which each token or tag of output is
+ * produced from. Output offsets refer to output before applying _replacements.
+ * @param _detectRemovedTags if false, entities of _removingTags are not detected at all instead of being rendered
+ * without tags. This is faster, but such entities are tokenized like ordinary text (i.e. "a.com" becomes "a . com").
+ * @return
+ */
+QString TargomanTextProcessor::text2IXML(const QString &_inStr,
+                                         INOUT bool& _spellCorrected,
+                                         const QString& _lang,
+                                         quint32 _lineNo,
+                                         bool _interactive,
+                                         bool _useSpellCorrector,                              
+                                         QList<enuTextTags::Type> _removingTags,
+                                         QList<stuIXMLReplacement> _replacements,
+                                         bool _putXmlTagsInSeperateList,
+                                         QVariantList* _lstXmlTags,
+                                         bool _setTagValue,
+                                         bool _convertToLower,
+                                         bool _detectSymbols,
+                                         bool _setTagIndex,
+                                         QVector<stuTextAlignment>* _alignment,
+                                         bool _detectRemovedTags) const
+{
+    if (_putXmlTagsInSeperateList == false || _lstXmlTags == NULL)
+        return convertText2IXML(_inStr, _spellCorrected, NULL, _lang, _lineNo, _interactive, _useSpellCorrector,
+                                _removingTags, _replacements, _setTagValue, _convertToLower, _detectSymbols,
+                                _setTagIndex, _alignment, _detectRemovedTags, 0);
+
+    stuIXMLTagList Tags;
+    QString IXML = convertText2IXML(_inStr, _spellCorrected, &Tags, _lang, _lineNo, _interactive, _useSpellCorrector,
+                                    _removingTags, _replacements, _setTagValue, _convertToLower, _detectSymbols,
+                                    _setTagIndex, _alignment, _detectRemovedTags, 0);
+    *_lstXmlTags = Tags.toVariantList();
+    return IXML;
+}
 
+/**
+ * @brief Converts input text to ixml and stores its tags in a typed list. Arguments are same as other overload.
+ * @param _tags will be filled with tags of output in order of their appearance.
+ */
+QString TargomanTextProcessor::text2IXML(const QString &_inStr,
+                                         INOUT bool &_spellCorrected,
+                                         INOUT stuIXMLTagList &_tags,
+                                         const QString &_lang,
+                                         quint32 _lineNo,
+                                         bool _interactive,
+                                         bool _useSpellCorrector,
+                                         QList<enuTextTags::Type> _removingTags,
+                                         QList<stuIXMLReplacement> _replacements,
+                                         bool _setTagValue,
+                                         bool _convertToLower,
+                                         bool _detectSymbols,
+                                         bool _setTagIndex,
+                                         QVector<stuTextAlignment>* _alignment,
+                                         bool _detectRemovedTags) const
+{
+    return convertText2IXML(_inStr, _spellCorrected, &_tags, _lang, _lineNo, _interactive, _useSpellCorrector,
+                            _removingTags, _replacements, _setTagValue, _convertToLower, _detectSymbols,
+                            _setTagIndex, _alignment, _detectRemovedTags, 0);
+}
 
-QStringList getIXMLLines(QString& _data)
+/**
+ * @brief Converts input text to ixml using options passed as a struct, which is the only way to pass a replacement
+ * set registered by registerReplacements().
+ * @param _tags will be filled with tags of output in order of their appearance.
+ * @exception throws exTextProcessor if _options.ReplacementSet is not registered.
+ */
+QString TargomanTextProcessor::text2IXML(const QString &_inStr,
+                                         INOUT bool &_spellCorrected,
+                                         INOUT stuIXMLTagList &_tags,
+                                         const stuText2IXMLOptions &_options) const
 {
-    _data = _data.replace (". .", "..");
-    _data = _data.replace (". .", "..");
-    _data = _data.replace ("  ", " ");
-    _data = _data.replace ("  ", " ");
+    return convertText2IXML(_inStr, _spellCorrected, &_tags, _options.Lang, _options.LineNo, _options.Interactive,
+                            _options.UseSpellCorrector, _options.RemovingTags, _options.Replacements,
+                            _options.SetTagValue, _options.ConvertToLower, _options.DetectSymbols,
+                            _options.SetTagIndex, _options.Alignment, _options.DetectRemovedTags,
+                            _options.ReplacementSet);
+}
 
-    _data = _data.replace (" . \"", " TGMN_DOT\"");
-    _data = _data.replace (" . )" , " TGMN_DOT)");
-    _data = _data.replace (" . ]" , " TGMN_DOT]");
-    _data = _data.replace (" . }" , " TGMN_DOT}");
+/**
+ * @brief fills options of batch and stream variants of text2IXML() from their positional arguments.
+ */
+static stuText2IXMLOptions text2IXMLOptions(const QString &_lang,
+                                            bool _useSpellCorrector,
+                                            const QList<enuTextTags::Type>& _removingTags,
+                                            const QList<stuIXMLReplacement>& _replacements,
+                                            bool _setTagValue,
+                                            bool _convertToLower,
+                                            bool _detectSymbols,
+                                            bool _setTagIndex,
+                                            bool _detectRemovedTags)
+{
+    stuText2IXMLOptions Options;
+    Options.Lang = _lang;
+    Options.UseSpellCorrector = _useSpellCorrector;
+    Options.RemovingTags = _removingTags;
+    Options.Replacements = _replacements;
+    Options.SetTagValue = _setTagValue;
+    Options.ConvertToLower = _convertToLower;
+    Options.DetectSymbols = _detectSymbols;
+    Options.SetTagIndex = _setTagIndex;
+    Options.DetectRemovedTags = _detectRemovedTags;
+    return Options;
+}
 
-    _data = _data.replace (" ? \"", " TGMN_QM\"");
-    _data = _data.replace (" ? )" , " TGMN_QM)");
-    _data = _data.replace (" ? ]" , " TGMN_QM]");
-    _data = _data.replace (" ? }" , " TGMN_QM}");
+/**
+ * @brief Converts a list of texts to ixml on internal thread pool. Texts are processed non-interactively and line
+ * number of each text is its index. Other arguments are same as text2IXML().
+ * @return result of each text in order of _inputs.
+ * @exception rethrows first exception thrown while processing texts.
+ */
+QVector<stuText2IXMLResult> TargomanTextProcessor::text2IXMLBatch(const QStringList &_inputs,
+                                                                  const QString &_lang,
+                                                                  bool _useSpellCorrector,
+                                                                  QList<enuTextTags::Type> _removingTags,
+                                                                  QList<stuIXMLReplacement> _replacements,
+                                                                  bool _setTagValue,
+                                                                  bool _convertToLower,
+                                                                  bool _detectSymbols,
+                                                                  bool _setTagIndex,
+                                                                  bool _detectRemovedTags) const
+{
+    return this->text2IXMLBatch(_inputs, text2IXMLOptions(_lang, _useSpellCorrector, _removingTags, _replacements,
+                                                          _setTagValue, _convertToLower, _detectSymbols, _setTagIndex,
+                                                          _detectRemovedTags));
+}
 
-    _data = _data.replace (" ! \"", " TGMN_EM\"\n");
-    _data = _data.replace (" ! )" , " TGMN_EM)\n");
-    _data = _data.replace (" ! ]" , " TGMN_EM]\n");
-    _data = _data.replace (" ! }" , " TGMN_EM}\n");
+/**
+ * @brief Same as other overload but takes options as a struct. LineNo, Interactive and Alignment of _options are
+ * ignored.
+ */
+QVector<stuText2IXMLResult> TargomanTextProcessor::text2IXMLBatch(const QStringList &_inputs,
+                                                                  const stuText2IXMLOptions &_options) const
+{
+    QVector<stuText2IXMLResult> Results(_inputs.size());
+    stuText2IXMLResult* ResultsData = Results.data();
+    BatchProcessor::instance().run(_inputs.size(), [&] (int _index) {
+        stuText2IXMLResult& Result = ResultsData[_index];
+        Result.IXML = convertText2IXML(_inputs.at(_index), Result.SpellCorrected, &Result.Tags, _options.Lang,
+                                       static_cast<quint32>(_index), false, _options.UseSpellCorrector,
+                                       _options.RemovingTags, _options.Replacements, _options.SetTagValue,
+                                       _options.ConvertToLower, _options.DetectSymbols, _options.SetTagIndex,
+                                       NULL, _options.DetectRemovedTags, _options.ReplacementSet);
+    });
+    return Results;
+}
 
-    _data = _data.replace (" . &gt;", " .&gt;");
-    _data = _data.replace ("  ", " ");
-    _data = _data.replace ("  ", " ");
-    _data = _data.replace (" . ", " .\n");
-    _data = _data.replace (" ? ", " ?\n");
-    _data = _data.replace (" ! ", " !\n");
+/**
+ * @brief runs _processor from _input to _output after checking that they are open.
+ */
+static quint64 runStream(StreamProcessor& _processor, QIODevice& _input, QIODevice& _output)
+{
+    if (!_input.isReadable())
+        throw exTextProcessor("Input device is not open for reading");
+    if (!_output.isWritable())
+        throw exTextProcessor("Output device is not open for writing");
+    return _processor.run(_input, _output);
+}
 
-    _data = _data.replace (" TGMN_DOT\"", " .\"\n");
-    _data = _data.replace (" TGMN_DOT)" , " .)\n");
-    _data = _data.replace (" TGMN_DOT]" , " .]\n");
-    _data = _data.replace (" TGMN_DOT]" , " .}\n");
+/**
+ * @brief opens descriptors as devices and passes them to _run. Descriptors are left open.
+ */
+static quint64 runOnDescriptors(int _inputFD, int _outputFD, const std::function<quint64(QIODevice&, QIODevice&)>& _run)
+{
+    QFile Input, Output;
+    if (!Input.open(_inputFD, QIODevice::ReadOnly))
+        throw exTextProcessor(QString("Unable to open input descriptor %1: %2").arg(_inputFD).arg(Input.errorString()));
+    if (!Output.open(_outputFD, QIODevice::WriteOnly))
+        throw exTextProcessor(QString("Unable to open output descriptor %1: %2").arg(_outputFD).arg(Output.errorString()));
+    quint64 Lines = _run(Input, Output);
+    if (!Output.flush())
+        throw exTextProcessor("Unable to write to output: " + Output.errorString());
+    return Lines;
+}
 
-    _data = _data.replace (" TGMN_QM\"", " ? \"\n");
-    _data = _data.replace (" TGMN_QM)", " ? )\n");
-    _data = _data.replace (" TGMN_QM]", " ? ]\n");
-    _data = _data.replace (" TGMN_QM}", " ? }\n");
+/**
+ * @brief Converts each line of _input to ixml and writes it as a line of _output. Lines are processed
+ * non-interactively on internal thread pool and written in order of input. Only a fixed number of lines per thread
+ * is kept in memory: reading waits for oldest line to be written. Line number of each line is its index and other
+ * arguments are same as text2IXML().
+ * @param _input device open for reading, read as UTF-8 until its end.
+ * @param _output device open for writing, written as UTF-8. Devices are only accessed from calling thread.
+ * @return number of lines processed.
+ * @exception rethrows first exception thrown while processing lines, after results of previous lines are written.
+ */
+quint64 TargomanTextProcessor::text2IXMLStream(QIODevice &_input,
+                                               QIODevice &_output,
+                                               const QString &_lang,
+                                               bool _useSpellCorrector,
+                                               QList<enuTextTags::Type> _removingTags,
+                                               QList<stuIXMLReplacement> _replacements,
+                                               bool _setTagValue,
+                                               bool _convertToLower,
+                                               bool _detectSymbols,
+                                               bool _setTagIndex,
+                                               bool _detectRemovedTags) const
+{
+    return this->text2IXMLStream(_input, _output, text2IXMLOptions(_lang, _useSpellCorrector, _removingTags,
+                                                                   _replacements, _setTagValue, _convertToLower,
+                                                                   _detectSymbols, _setTagIndex, _detectRemovedTags));
+}
 
-    _data = _data.replace (" TGMN_EM\"\n", " ! \"\n");
-    _data = _data.replace (" TGMN_EM)\n", " ! )\n");
-    _data = _data.replace (" TGMN_EM]\n", " ! ]\n");
-    _data = _data.replace (" TGMN_EM}\n", " ! }\n");
+/**
+ * @brief Same as other overload but takes options as a struct. LineNo, Interactive and Alignment of _options are
+ * ignored.
+ */
+quint64 TargomanTextProcessor::text2IXMLStream(QIODevice &_input,
+                                               QIODevice &_output,
+                                               const stuText2IXMLOptions &_options) const
+{
+    currentRules();
+    StreamProcessor Processor([&] (const QString& _line, quint32 _lineNo) {
+        bool SpellCorrected = false;
+        return convertText2IXML(_line, SpellCorrected, NULL, _options.Lang, _lineNo, false,
+                                _options.UseSpellCorrector, _options.RemovingTags, _options.Replacements,
+                                _options.SetTagValue, _options.ConvertToLower, _options.DetectSymbols,
+                                _options.SetTagIndex, NULL, _options.DetectRemovedTags, _options.ReplacementSet);
+    });
+    return runStream(Processor, _input, _output);
+}
 
-    return _data.split ('\n', QString::SkipEmptyParts);
+/**
+ * @brief Same as other overload but reads from and writes to file descriptors, i.e. 0 and 1 for standard input and
+ * output.
+ */
+quint64 TargomanTextProcessor::text2IXMLStream(int _inputFD,
+                                               int _outputFD,
+                                               const QString &_lang,
+                                               bool _useSpellCorrector,
+                                               QList<enuTextTags::Type> _removingTags,
+                                               QList<stuIXMLReplacement> _replacements,
+                                               bool _setTagValue,
+                                               bool _convertToLower,
+                                               bool _detectSymbols,
+                                               bool _setTagIndex,
+                                               bool _detectRemovedTags) const
+{
+    return this->text2IXMLStream(_inputFD, _outputFD, text2IXMLOptions(_lang, _useSpellCorrector, _removingTags,
+                                                                       _replacements, _setTagValue, _convertToLower,
+                                                                       _detectSymbols, _setTagIndex,
+                                                                       _detectRemovedTags));
 }
 
+/**
+ * @brief Same as other overload but takes options as a struct.
+ */
+quint64 TargomanTextProcessor::text2IXMLStream(int _inputFD, int _outputFD, const stuText2IXMLOptions &_options) const
+{
+    return runOnDescriptors(_inputFD, _outputFD, [&] (QIODevice& _input, QIODevice& _output) {
+        return this->text2IXMLStream(_input, _output, _options);
+    });
+}
 
 /**
- * @brief TextProcessor::ixml2Text
- * @param _ixml
- * @return
+ * @brief returns name of a tag as it is rendered in ixml, i.e. "<number>" or "<number-0>" for indexed tags.
+ */
+QString stuIXMLTagList::tagName(int _index) const
+{
+    const stuIXMLTag& Tag = this->Tags.at(_index);
+    if (this->IndexedTags)
+        return QString("<%1-%2>").arg(enuTextTags::toStr(Tag.Type)).arg(Tag.Index).toLower();
+    return QString("<%1>").arg(enuTextTags::toStr(Tag.Type)).toLower();
+}
+
+/**
+ * @brief converts tags to the legacy list of maps with tag name as "t" and value as "v".
+ */
+QVariantList stuIXMLTagList::toVariantList() const
+{
+    QVariantList List;
+    List.reserve(this->Tags.size());
+    for (int i = 0; i < this->Tags.size(); ++i){
+        QVariantMap Tag;
+        Tag.insert("t", this->tagName(i));
+        Tag.insert("v", this->value(i).toString());
+        List.append(Tag);
+    }
+    return List;
+}
+
+/**
+ * @brief appends _str to _json as a JSON string.
+ */
+static void appendJsonString(QByteArray& _json, const QString& _str)
+{
+    static const char Hex[] = "0123456789abcdef";
+    _json.append('"');
+    QByteArray UTF8 = _str.toUtf8();
+    for (int i = 0; i < UTF8.size(); ++i){
+        char Char = UTF8.at(i);
+        switch (Char){
+        case '"':  _json.append("\\\""); break;
+        case '\\': _json.append("\\\\"); break;
+        case '\b': _json.append("\\b"); break;
+        case '\f': _json.append("\\f"); break;
+        case '\n': _json.append("\\n"); break;
+        case '\r': _json.append("\\r"); break;
+        case '\t': _json.append("\\t"); break;
+        default:
+            if (static_cast<unsigned char>(Char) < 0x20){
+                _json.append("\\u00");
+                _json.append(Hex[(Char >> 4) & 0xF]);
+                _json.append(Hex[Char & 0xF]);
+            }else
+                _json.append(Char);
+        }
+    }
+    _json.append('"');
+}
+
+/**
+ * @brief writes tags as a compact JSON array in the same format as toVariantList() without building intermediate
+ * maps.
+ */
+QByteArray stuIXMLTagList::toJson() const
+{
+    QByteArray Json;
+    Json.reserve(this->Values.size() * 2 + this->Tags.size() * 32 + 2);
+    Json.append('[');
+    for (int i = 0; i < this->Tags.size(); ++i){
+        if (i)
+            Json.append(',');
+        Json.append("{\"t\":");
+        appendJsonString(Json, this->tagName(i));
+        Json.append(",\"v\":");
+        appendJsonString(Json, this->value(i).toString());
+        Json.append('}');
+    }
+    Json.append(']');
+    return Json;
+}
+
+/**
+ * @brief Processes input text the same way as text2IXML() but returns tokens and their tags instead of an ixml string,
+ * so tokens can be used without rendering and parsing ixml. Input is processed in non-interactive mode.
+ * @param _spellCorrected will be set to true if spell corrector has changed any token.
+ * @return tokens of processed text.
+ */
+stuTokenStream TargomanTextProcessor::text2Tokens(const QString &_inStr,
+                                                  INOUT bool &_spellCorrected,
+                                                  const QString &_lang,
+                                                  quint32 _lineNo,
+                                                  bool _useSpellCorrector,
+                                                  bool _convertToLower,
+                                                  bool _detectSymbols) const
+{
+    RulesSnapshot::Ptr_t Rules = currentRules();
+    const char* LangCode = ISO639getAlpha2(_lang.toLatin1().constData());
+
+    stuTokenStream Stream;
+    Rules->ixmlWriter().convert2Tokens(_inStr,
+                                       Stream,
+                                       _spellCorrected,
+                                       LangCode ? LangCode : "",
+                                       _lineNo,
+                                       _useSpellCorrector,
+                                       _convertToLower,
+                                       _detectSymbols);
+    return Stream;
+}
+
+/**
+ * @brief converts ixml text to plain text. Input is walked once by IXMLReader.
+ * @param _ixml input ixml text.
+ * @param _detokenize whether quotes, punctuations and brackets must be attached to their tokens or not.
+ * @param _hinidiDigits whether digits must be converted to hindi digits or not.
+ * @param _arabicPunctuations whether punctuations must be converted to arabic ones or not.
+ * @param _breakSentences if true, each sentence is written in a separate line.
+ * @param _convertToLower whether output must be converted to lower case or not.
+ * @return plain text.
  */
 QString TargomanTextProcessor::ixml2Text(const QString &_ixml,
                                          bool _detokenize,
@@ -214,106 +733,75 @@ QString TargomanTextProcessor::ixml2Text(const QString &_ixml,
                                          bool _breakSentences,
                                          bool _convertToLower) const
 {
-    if (!Initialized)
+    if (!RulesSnapshot::current())
         throw exTextProcessor("Text Processor has not been initialized");
 
-    thread_local static QRegularExpression RxSuffixes = QRegularExpression(
-                                                            QString("(?: )('[%1])(?: )").arg(IXMLWriter::instance().supportedSuffixes()));
-
-    thread_local static QRegularExpression RxDetokenDQuote = QRegularExpression("(?:(?: |^)\" )([^\"]+)(?: \"(?: |$))");
-    thread_local static QRegularExpression RxDetokenQuote  = QRegularExpression("(?:(?: |^)\\' )([^\\']+)(?: \\'(?: |$))");
-    thread_local static QRegularExpression RxAllIXMLTags =
-            QRegularExpression(
-                QString("<%1>").arg(enuTextTags::options().join(">|<")).toLower() +
-                QString("|</%1>").arg(enuTextTags::options().join(">|</")).toLower()
-                );
-
-
-    QString IXML = _ixml;
-    QStringList Textlines;
-    foreach(auto Line, IXML.split("\n", QString::SkipEmptyParts)){
-        QStringList IXMLLines = getIXMLLines (Line);
-        for (int i = 0; i < IXMLLines.count (); ++i)
-        {
-            //remove first spaces
-            while(IXMLLines[i].size() && IXMLLines[i].at(0) == ' ')
-                IXMLLines[i].remove(0,1);
-
-            IXMLLines[i] = IXMLLines[i].replace (RxSuffixes, "\\1 ");
-            IXMLLines[i] = IXMLLines[i].replace (RxAllIXMLTags,"");
-
-            if (_detokenize){
-                int Pos=0;
-                QRegularExpressionMatch Match;
-                while ((Pos=IXMLLines[i].indexOf(RxDetokenDQuote,0, &Match)) != -1) {
-                    IXMLLines[i]=
-                            IXMLLines[i].mid(0,Pos) +
-                            " \"" + Match.captured(1) + "\" " +
-                            IXMLLines[i].mid(Pos + Match.capturedLength());
-                }
-
-                Pos=0;
-                while ((Pos=IXMLLines[i].indexOf(RxDetokenQuote,0, &Match)) != -1) {
-                    IXMLLines[i]=
-                            IXMLLines[i].mid(0,Pos) +
-                            " '" + Match.captured(1) + "' " +
-                            IXMLLines[i].mid(Pos + Match.capturedLength());
-                }
-            }
-            IXMLLines[i] = IXMLLines[i].replace ("&gt;", ">");
-            IXMLLines[i] = IXMLLines[i].replace ("&lt;", "<");
-            IXMLLines[i] = IXMLLines[i].replace ("&amp;", "&");
-
-            if (_detokenize){
-                IXMLLines[i] = IXMLLines[i].replace ("  ", " ");
-                IXMLLines[i] = IXMLLines[i].replace ("  ", " ");
-                IXMLLines[i] = IXMLLines[i].replace (" .", ".");
-                IXMLLines[i] = IXMLLines[i].replace (" ,", ",");
-                IXMLLines[i] = IXMLLines[i].replace (" ;", ";");
-                IXMLLines[i] = IXMLLines[i].replace (" :", ":");
-                IXMLLines[i] = IXMLLines[i].replace (" ?", "?");
-                IXMLLines[i] = IXMLLines[i].replace (" !", "!");
-                IXMLLines[i] = IXMLLines[i].replace (" )", ")");
-                IXMLLines[i] = IXMLLines[i].replace (") ", ")");
-                IXMLLines[i] = IXMLLines[i].replace ("( ", "(");
-            }
-            if (_hinidiDigits || _arabicPunctuations){
-                static QString ArabicCharacters=QStringLiteral("۰۱۲۳۴۵۶۷۸۹؟؛،");
-                for (int j=0; j<IXMLLines[i].size(); ++j){
-                    if(_hinidiDigits)
-                        switch(IXMLLines[i][j].unicode()){
-                        case '0': IXMLLines[i][j]=ArabicCharacters.at(0);break;
-                        case '1': IXMLLines[i][j]=ArabicCharacters.at(1);break;
-                        case '2': IXMLLines[i][j]=ArabicCharacters.at(2);break;
-                        case '3': IXMLLines[i][j]=ArabicCharacters.at(3);break;
-                        case '4': IXMLLines[i][j]=ArabicCharacters.at(4);break;
-                        case '5': IXMLLines[i][j]=ArabicCharacters.at(5);break;
-                        case '6': IXMLLines[i][j]=ArabicCharacters.at(6);break;
-                        case '7': IXMLLines[i][j]=ArabicCharacters.at(7);break;
-                        case '8': IXMLLines[i][j]=ArabicCharacters.at(8);break;
-                        case '9': IXMLLines[i][j]=ArabicCharacters.at(9);break;
-                        }
-
-                    if(_arabicPunctuations)
-                        switch(IXMLLines[i][j].unicode()){
-                        case ';': IXMLLines[i][j]=ArabicCharacters.at(10);break;
-                        case '?': IXMLLines[i][j]=ArabicCharacters.at(11);break;
-                        case ',': IXMLLines[i][j]=ArabicCharacters.at(12);break;
-                        }
-                }
-            }
-
-            
-        }        
-        if (_breakSentences)
-            Textlines.append(IXMLLines.join("\n"));
-        else
-            Textlines.append(IXMLLines.join(" "));
-    }
-    QString Result = Textlines.join("\n");
+    QString Result = IXMLReader(_detokenize, _hinidiDigits, _arabicPunctuations, _breakSentences).convert2Text(_ixml);
     return  _convertToLower ? Result.toLower() : Result;
 }
 
+/**
+ * @brief Converts a list of ixmls to plain text on internal thread pool. Arguments are same as ixml2Text().
+ * @return text of each ixml in order of _ixmls.
+ */
+QStringList TargomanTextProcessor::ixml2TextBatch(const QStringList &_ixmls,
+                                                  bool _detokenize,
+                                                  bool _hinidiDigits,
+                                                  bool _arabicPunctuations,
+                                                  bool _breakSentences,
+                                                  bool _convertToLower) const
+{
+    if (!RulesSnapshot::current())
+        throw exTextProcessor("Text Processor has not been initialized");
+
+    QVector<QString> Results(_ixmls.size());
+    QString* ResultsData = Results.data();
+    BatchProcessor::instance().run(_ixmls.size(), [&] (int _index) {
+        QString Text = IXMLReader(_detokenize, _hinidiDigits, _arabicPunctuations, _breakSentences).convert2Text(
+                           _ixmls.at(_index));
+        ResultsData[_index] = _convertToLower ? Text.toLower() : Text;
+    });
+    return Results.toList();
+}
+
+/**
+ * @brief Converts each line of _input from ixml to plain text and writes it as a line of _output. Devices are handled
+ * as in text2IXMLStream() and other arguments are same as ixml2Text().
+ * @return number of lines processed.
+ */
+quint64 TargomanTextProcessor::ixml2TextStream(QIODevice &_input,
+                                               QIODevice &_output,
+                                               bool _detokenize,
+                                               bool _hinidiDigits,
+                                               bool _arabicPunctuations,
+                                               bool _breakSentences,
+                                               bool _convertToLower) const
+{
+    currentRules();
+    StreamProcessor Processor([&] (const QString& _line, quint32) {
+        QString Text = IXMLReader(_detokenize, _hinidiDigits, _arabicPunctuations, _breakSentences).convert2Text(_line);
+        return _convertToLower ? Text.toLower() : Text;
+    });
+    return runStream(Processor, _input, _output);
+}
+
+/**
+ * @brief Same as other overload but reads from and writes to file descriptors.
+ */
+quint64 TargomanTextProcessor::ixml2TextStream(int _inputFD,
+                                               int _outputFD,
+                                               bool _detokenize,
+                                               bool _hinidiDigits,
+                                               bool _arabicPunctuations,
+                                               bool _breakSentences,
+                                               bool _convertToLower) const
+{
+    return runOnDescriptors(_inputFD, _outputFD, [&] (QIODevice& _input, QIODevice& _output) {
+        return this->ixml2TextStream(_input, _output, _detokenize, _hinidiDigits, _arabicPunctuations, _breakSentences,
+                                     _convertToLower);
+    });
+}
+
 /**
  * @brief TextProcessor::normalizeText Normalizes based on normalization rules. It will also correct miss-spells if
  *        _lang is provided
@@ -335,7 +823,7 @@ QString TargomanTextProcessor::normalizeText(const QString _input,
         bool IsArabic = _lang == "fa" || _lang == "ar";
         Output = TargomanTextProcessor::ixml2Text(Tokenized, true, IsArabic, IsArabic, false);
     } else
-        Output = Normalizer::instance().normalize(_input, _interactive);
+        Output = currentRules()->normalizer().normalize(_input, _interactive);
 
     Output = Normalizer::fullTrim(Output);
 
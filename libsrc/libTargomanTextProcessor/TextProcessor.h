@@ -28,6 +28,8 @@
 #define TARGOMAN_NLPLIBS_TARGOMANTP_TEXTPROCESSOR_H
 
 #include <QString>
+#include <QStringList>
+#include <QVector>
 #include "libTargomanCommon/Macros.h"
 #include "libTargomanCommon/exTargomanBase.h"
 #include "libTargomanCommon/Logger.h"
@@ -35,6 +37,8 @@
 
 #include "ISO639.h" //From https://github.com/softnhard/ISO639
 
+class QIODevice;
+
 namespace Targoman {
 namespace NLPLibs {
 
@@ -64,6 +68,174 @@ struct stuIXMLReplacement{
     {}
 };
 
+/**
+ * @brief A token of processed text. Text of token is a view to stuTokenStream::Buffer, for tagged tokens it is the
+ * value of tag.
+ */
+struct stuTextToken{
+    int Offset;                             /**< Offset of token text in stuTokenStream::Buffer.*/
+    int Length;                             /**< Length of token text.*/
+    enuTextTags::Type Tag;                  /**< Type of tag or enuTextTags::Unknown for plain tokens.*/
+    bool SpellCorrected;                    /**< Whether token was produced by spell corrector or not.*/
+    int SourceOffset;                       /**< Offset of input text which token is produced from or -1.*/
+    int SourceLength;                       /**< Length of input text which token is produced from.*/
+
+    stuTextToken(int _offset = 0,
+                 int _length = 0,
+                 enuTextTags::Type _tag = enuTextTags::Unknown,
+                 bool _spellCorrected = false,
+                 int _sourceOffset = -1,
+                 int _sourceLength = 0):
+        Offset(_offset),
+        Length(_length),
+        Tag(_tag),
+        SpellCorrected(_spellCorrected),
+        SourceOffset(_sourceOffset),
+        SourceLength(_sourceLength)
+    {}
+};
+
+/**
+ * @brief Maps a part of output text to the part of input text which it is produced from. Offsets are in UTF-16 code
+ * units. SourceOffset is -1 for parts which are inserted by text processor.
+ */
+struct stuTextAlignment{
+    int OutputOffset;
+    int OutputLength;
+    int SourceOffset;
+    int SourceLength;
+
+    stuTextAlignment(int _outputOffset = 0, int _outputLength = 0, int _sourceOffset = -1, int _sourceLength = 0):
+        OutputOffset(_outputOffset),
+        OutputLength(_outputLength),
+        SourceOffset(_sourceOffset),
+        SourceLength(_sourceLength)
+    {}
+};
+
+/**
+ * @brief Tokens of a processed text. Buffer holds texts of all tokens separated by spaces so it is the tokenized text
+ * itself.
+ */
+struct stuTokenStream{
+    QString Buffer;
+    QVector<stuTextToken> Tokens;
+
+    inline QStringRef text(int _index) const{
+        const stuTextToken& Token = this->Tokens.at(_index);
+        return QStringRef(&this->Buffer, Token.Offset, Token.Length);
+    }
+    inline void clear(){
+        this->Buffer.clear();
+        this->Tokens.clear();
+    }
+};
+
+/**
+ * @brief A tag which is rendered in ixml. Value is stored in stuIXMLTagList::Values.
+ */
+struct stuIXMLTag{
+    enuTextTags::Type Type;
+    int Index;                              /**< Index of tag among tags of same type.*/
+    int ValueOffset;                        /**< Offset of value in stuIXMLTagList::Values.*/
+    int ValueLength;                        /**< Length of value.*/
+};
+
+/**
+ * @brief Tags of an ixml in order of their appearance. Values of all tags are stored in a single buffer.
+ */
+struct stuIXMLTagList{
+    QVector<stuIXMLTag> Tags;
+    QString Values;
+    bool IndexedTags = false;               /**< Whether tag names include index of tag or not.*/
+
+    inline void append(enuTextTags::Type _type, int _index, const QString& _value){
+        this->Tags.append({_type, _index, this->Values.size(), _value.size()});
+        this->Values.append(_value);
+    }
+    inline QStringRef value(int _index) const{
+        const stuIXMLTag& Tag = this->Tags.at(_index);
+        return QStringRef(&this->Values, Tag.ValueOffset, Tag.ValueLength);
+    }
+    inline void clear(){
+        this->Tags.clear();
+        this->Values.clear();
+    }
+
+    QString tagName(int _index) const;
+    QVariantList toVariantList() const;
+    QByteArray toJson() const;
+};
+
+/**
+ * @brief Cumulative counters of a stage of text2IXML pipeline, collected while pipeline profiling is enabled.
+ */
+struct stuPipelineStageStats{
+    QString Name;                           /**< Name of stage as used in debug logs, i.e. "NRM" or "URL".*/
+    quint64 Calls;                          /**< Number of phrases processed by stage.*/
+    quint64 Skipped;                        /**< Number of phrases for which stage was skipped.*/
+    quint64 Matches;                        /**< Entities found by detection stages or phrases changed by other stages.*/
+    quint64 ElapsedNS;                      /**< Total time spent in stage in nanoseconds.*/
+};
+
+/**
+ * @brief Options of text2IXML() and of its batch and stream variants. Members and their defaults are same as
+ * positional arguments of text2IXML(), except Interactive which is false by default so that calls with default options
+ * never wait for user input and can run concurrently. Options also include handle of a registered replacement set.
+ * Batch and stream variants ignore LineNo, Interactive and Alignment.
+ */
+struct stuText2IXMLOptions{
+    QString Lang;
+    quint32 LineNo = 0;
+    bool Interactive = false;
+    bool UseSpellCorrector = true;
+    QList<enuTextTags::Type> RemovingTags;
+    QList<stuIXMLReplacement> Replacements;
+    quint32 ReplacementSet = 0;             /**< Handle returned by registerReplacements() which is applied before Replacements, or 0.*/
+    bool SetTagValue = true;
+    bool ConvertToLower = false;
+    bool DetectSymbols = true;
+    bool SetTagIndex = false;
+    QVector<stuTextAlignment>* Alignment = NULL;
+    bool DetectRemovedTags = true;
+};
+
+/**
+ * @brief Result of an item of text2IXMLBatch().
+ */
+struct stuText2IXMLResult{
+    QString IXML;
+    bool SpellCorrected = false;            /**< Whether input was changed by spell corrector or not.*/
+    stuIXMLTagList Tags;                    /**< Tags of IXML in order of their appearance.*/
+};
+
+/**
+ * @brief Main entry point of text processor.
+ *
+ * Once init() has returned, text2IXML(), text2Tokens(), ixml2Text() and normalizeText() can be called concurrently from multiple
+ * threads on the same instance as long as interactive mode is not used. Interactive calls are serialized internally
+ * as they modify loaded rules and must not be mixed with concurrent non-interactive calls.
+ *
+ * Rules can be reloaded by reload() while requests are being processed. New rules are loaded aside and replace old
+ * ones at once; requests which are already running finish with the rules they have started with.
+ *
+ * When setCollectUnknowns() is enabled, unresolved characters and suspicious tokens met in non-interactive calls are
+ * recorded without blocking so they can be reviewed offline using collectedUnknowns() or dumpCollectedUnknowns().
+ *
+ * Rules learned in interactive mode are appended to journals beside config files and replayed on load, until
+ * compactLearnedRules() folds them into config files.
+ *
+ * text2IXML() runs a pipeline of stages which are compiled once per loaded rules. Stages of tags which are removed
+ * from output can be skipped entirely by passing _detectRemovedTags as false, and time spent in each stage can be
+ * collected using setPipelineProfiling() and pipelineStats().
+ *
+ * Replacements which are used for many texts can be compiled once by registerReplacements() and passed to
+ * text2IXML() by the returned handle in stuText2IXMLOptions.
+ *
+ * Lists of texts can be processed on an internal thread pool by text2IXMLBatch() and ixml2TextBatch(), which return
+ * results in order of inputs. Files of any size can be processed line by line by text2IXMLStream() and
+ * ixml2TextStream(), which keep a bounded number of lines in memory.
+ */
 class TargomanTextProcessor
 {
 public:
@@ -82,6 +254,21 @@ public:
 
     bool init(const stuConfigs &_configs);
     bool init(QSharedPointer<QSettings> _configSettings = QSharedPointer<QSettings>());
+    bool reload();
+    bool reload(const stuConfigs &_configs);
+    quint64 rulesVersion() const;
+    qint64 lastReloadDuration() const;
+
+    void setCollectUnknowns(bool _active);
+    QVariantList collectedUnknowns(bool _reset = false) const;
+    void dumpCollectedUnknowns(const QString& _filePath, bool _reset = false) const;
+    void compactLearnedRules() const;
+    void setPipelineProfiling(bool _active);
+    QList<stuPipelineStageStats> pipelineStats(bool _reset = false) const;
+    quint32 registerReplacements(const QList<stuIXMLReplacement>& _replacements);
+    bool unregisterReplacements(quint32 _handle);
+    void setBatchThreadCount(int _count);
+    int batchThreadCount() const;
 
     QString text2IXML(const QString& _inStr,
                       INOUT bool &_spellCorrected,                      
@@ -96,7 +283,78 @@ public:
                       bool _setTagValue = true,
                       bool _convertToLower = false,
                       bool _detectSymbols = true,
-                      bool _setTagIndex = false) const;
+                      bool _setTagIndex = false,
+                      QVector<stuTextAlignment>* _alignment = NULL,
+                      bool _detectRemovedTags = true) const;
+
+    QString text2IXML(const QString& _inStr,
+                      INOUT bool &_spellCorrected,
+                      INOUT stuIXMLTagList& _tags,
+                      const QString& _lang = "",
+                      quint32 _lineNo = 0,
+                      bool _interactive = true,
+                      bool _useSpellCorrector = true,
+                      QList<enuTextTags::Type> _removingTags = QList<enuTextTags::Type>(),
+                      QList<stuIXMLReplacement> _replacements = QList<stuIXMLReplacement>(),
+                      bool _setTagValue = true,
+                      bool _convertToLower = false,
+                      bool _detectSymbols = true,
+                      bool _setTagIndex = false,
+                      QVector<stuTextAlignment>* _alignment = NULL,
+                      bool _detectRemovedTags = true) const;
+
+    QString text2IXML(const QString& _inStr,
+                      INOUT bool &_spellCorrected,
+                      INOUT stuIXMLTagList& _tags,
+                      const stuText2IXMLOptions& _options) const;
+
+    QVector<stuText2IXMLResult> text2IXMLBatch(const QStringList& _inputs,
+                                               const QString& _lang = "",
+                                               bool _useSpellCorrector = true,
+                                               QList<enuTextTags::Type> _removingTags = QList<enuTextTags::Type>(),
+                                               QList<stuIXMLReplacement> _replacements = QList<stuIXMLReplacement>(),
+                                               bool _setTagValue = true,
+                                               bool _convertToLower = false,
+                                               bool _detectSymbols = true,
+                                               bool _setTagIndex = false,
+                                               bool _detectRemovedTags = true) const;
+
+    QVector<stuText2IXMLResult> text2IXMLBatch(const QStringList& _inputs, const stuText2IXMLOptions& _options) const;
+
+    quint64 text2IXMLStream(QIODevice& _input,
+                            QIODevice& _output,
+                            const QString& _lang = "",
+                            bool _useSpellCorrector = true,
+                            QList<enuTextTags::Type> _removingTags = QList<enuTextTags::Type>(),
+                            QList<stuIXMLReplacement> _replacements = QList<stuIXMLReplacement>(),
+                            bool _setTagValue = true,
+                            bool _convertToLower = false,
+                            bool _detectSymbols = true,
+                            bool _setTagIndex = false,
+                            bool _detectRemovedTags = true) const;
+
+    quint64 text2IXMLStream(int _inputFD,
+                            int _outputFD,
+                            const QString& _lang = "",
+                            bool _useSpellCorrector = true,
+                            QList<enuTextTags::Type> _removingTags = QList<enuTextTags::Type>(),
+                            QList<stuIXMLReplacement> _replacements = QList<stuIXMLReplacement>(),
+                            bool _setTagValue = true,
+                            bool _convertToLower = false,
+                            bool _detectSymbols = true,
+                            bool _setTagIndex = false,
+                            bool _detectRemovedTags = true) const;
+
+    quint64 text2IXMLStream(QIODevice& _input, QIODevice& _output, const stuText2IXMLOptions& _options) const;
+    quint64 text2IXMLStream(int _inputFD, int _outputFD, const stuText2IXMLOptions& _options) const;
+
+    stuTokenStream text2Tokens(const QString& _inStr,
+                               INOUT bool &_spellCorrected,
+                               const QString& _lang = "",
+                               quint32 _lineNo = 0,
+                               bool _useSpellCorrector = true,
+                               bool _convertToLower = false,
+                               bool _detectSymbols = true) const;
 
     QString ixml2Text(const QString& _ixml,
                       bool _detokenize = true,
@@ -105,6 +363,29 @@ public:
                       bool _breakSentences = false,
                       bool _convertToLower = false) const;
 
+    QStringList ixml2TextBatch(const QStringList& _ixmls,
+                               bool _detokenize = true,
+                               bool _hinidiDigits = false,
+                               bool _arabicPunctuations = false,
+                               bool _breakSentences = false,
+                               bool _convertToLower = false) const;
+
+    quint64 ixml2TextStream(QIODevice& _input,
+                            QIODevice& _output,
+                            bool _detokenize = true,
+                            bool _hinidiDigits = false,
+                            bool _arabicPunctuations = false,
+                            bool _breakSentences = false,
+                            bool _convertToLower = false) const;
+
+    quint64 ixml2TextStream(int _inputFD,
+                            int _outputFD,
+                            bool _detokenize = true,
+                            bool _hinidiDigits = false,
+                            bool _arabicPunctuations = false,
+                            bool _breakSentences = false,
+                            bool _convertToLower = false) const;
+
     inline QString normalizeText(const QString _input,
                                  bool _interactive,
                                  const QString &_lang,
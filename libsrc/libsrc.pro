@@ -13,8 +13,21 @@ DIST_HEADERS += \
 # +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-#
 PRIVATE_HEADERS += \
     libTargomanTextProcessor/Private/Normalizer.h \
+    libTargomanTextProcessor/Private/CharScanner.h \
     libTargomanTextProcessor/Private/Unicode.hpp \
     libTargomanTextProcessor/Private/IXMLWriter.h \
+    libTargomanTextProcessor/Private/IXMLReader.h \
+    libTargomanTextProcessor/Private/IXMLReplacementSet.h \
+    libTargomanTextProcessor/Private/BatchProcessor.h \
+    libTargomanTextProcessor/Private/StreamProcessor.h \
+    libTargomanTextProcessor/Private/EntityTagger.h \
+    libTargomanTextProcessor/Private/AbbreviationMatcher.h \
+    libTargomanTextProcessor/Private/URLMatcher.h \
+    libTargomanTextProcessor/Private/SourceMap.h \
+    libTargomanTextProcessor/Private/RulesSnapshot.h \
+    libTargomanTextProcessor/Private/UnknownCollector.h \
+    libTargomanTextProcessor/Private/PipelineStats.h \
+    libTargomanTextProcessor/Private/LearnedRulesJournal.h \
     libTargomanTextProcessor/Private/SpellCorrector.h \
     libTargomanTextProcessor/Private/Configs.h \
     libTargomanTextProcessor/Private/SpellCorrectors/PersianSpellCorrector.h
@@ -22,9 +35,23 @@ PRIVATE_HEADERS += \
 # +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-#
 SOURCES += libID.cpp \
     libTargomanTextProcessor/Private/Normalizer.cpp \
+    libTargomanTextProcessor/Private/Unicode.cpp \
+    libTargomanTextProcessor/Private/CharScanner.cpp \
     libTargomanTextProcessor/TextProcessor.cpp \
     libTargomanTextProcessor/TextProcessor_c.cpp \
     libTargomanTextProcessor/Private/IXMLWriter.cpp \
+    libTargomanTextProcessor/Private/IXMLReader.cpp \
+    libTargomanTextProcessor/Private/IXMLReplacementSet.cpp \
+    libTargomanTextProcessor/Private/BatchProcessor.cpp \
+    libTargomanTextProcessor/Private/StreamProcessor.cpp \
+    libTargomanTextProcessor/Private/EntityTagger.cpp \
+    libTargomanTextProcessor/Private/AbbreviationMatcher.cpp \
+    libTargomanTextProcessor/Private/URLMatcher.cpp \
+    libTargomanTextProcessor/Private/SourceMap.cpp \
+    libTargomanTextProcessor/Private/RulesSnapshot.cpp \
+    libTargomanTextProcessor/Private/UnknownCollector.cpp \
+    libTargomanTextProcessor/Private/PipelineStats.cpp \
+    libTargomanTextProcessor/Private/LearnedRulesJournal.cpp \
     libTargomanTextProcessor/Private/SpellCorrector.cpp \
     libTargomanTextProcessor/Private/Configs.cpp \
     libTargomanTextProcessor/Private/SpellCorrectors/PersianSpellCorrector.cpp
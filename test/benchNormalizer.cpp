@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <cstdlib>
+#include <atomic>
+#include <iostream>
+#include <QStringList>
+#include <QElapsedTimer>
+#include "libTargomanTextProcessor/Private/RulesSnapshot.h"
+#include "libTargomanTextProcessor/Private/CharScanner.h"
+
+using namespace Targoman::NLPLibs::TargomanTP::Private;
+
+#if defined(__GLIBC__)
+/******************************************************************************/
+// Counts heap allocations of whole process by interposing glibc allocator.
+static std::atomic<quint64> AllocationCount(0);
+
+extern "C" {
+void* __libc_malloc(size_t _size);
+void* __libc_calloc(size_t _count, size_t _size);
+void* __libc_realloc(void* _ptr, size_t _size);
+
+void* malloc(size_t _size){
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(_size);
+}
+void* calloc(size_t _count, size_t _size){
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(_count, _size);
+}
+void* realloc(void* _ptr, size_t _size){
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(_ptr, _size);
+}
+}
+#endif
+
+/**
+ * @brief Normalizes whole sentence into a caller owned buffer which is reused between sentences.
+ */
+static void normalizeAppending(Normalizer& _normalizer, const QString& _sentence, QString& _output)
+{
+    stuNormalizationContext Context;
+    _output.resize(0);
+    _normalizer.normalize(_sentence.constData(), _sentence.size(), Context, _output);
+}
+
+/**
+ * @brief Reports number of heap allocations per sentence of normalizing into a reused output buffer. Text processor
+ * must be initialized before calling this function.
+ */
+void benchmarkNormalizerAllocations(const QStringList& _sentences, int _rounds)
+{
+#if defined(__GLIBC__)
+    RulesSnapshot::Ptr_t Rules = RulesSnapshot::current();
+    if (!Rules || _sentences.isEmpty() || _rounds <= 0)
+        return;
+
+    QString Output;
+    Output.reserve(1024);
+    // Warm up so that one time allocations are not counted.
+    foreach (const QString& Sentence, _sentences)
+        normalizeAppending(Rules->normalizer(), Sentence, Output);
+
+    quint64 Start = AllocationCount.load();
+    for (int Round = 0; Round < _rounds; ++Round)
+        foreach (const QString& Sentence, _sentences)
+            normalizeAppending(Rules->normalizer(), Sentence, Output);
+    quint64 Allocations = AllocationCount.load() - Start;
+    std::cout<<"Appending: "<<static_cast<double>(Allocations) / (_rounds * _sentences.size())
+             <<" allocations per sentence"<<std::endl;
+#else
+    Q_UNUSED(_sentences)
+    Q_UNUSED(_rounds)
+    std::cout<<"Allocation counting is only supported on glibc"<<std::endl;
+#endif
+}
+
+/**
+ * @brief Reports time spent on finding character classes of each sentence by dispatched SIMD kernel and by portable
+ * kernel.
+ */
+void benchmarkCharClasses(const QStringList& _sentences, int _rounds)
+{
+    if (_sentences.isEmpty() || _rounds <= 0)
+        return;
+
+    auto measure = [&](quint16 (*_classesOf)(const QChar*, int), const char* _name){
+        volatile quint16 Classes = stuCharClasses::None;
+        QElapsedTimer Timer;
+        Timer.start();
+        for (int Round = 0; Round < _rounds; ++Round)
+            foreach (const QString& Sentence, _sentences)
+                Classes = Classes | _classesOf(Sentence.constData(), Sentence.size());
+        std::cout<<_name<<": "<<static_cast<double>(Timer.nsecsElapsed()) / (_rounds * _sentences.size())
+                 <<" ns per sentence"<<std::endl;
+    };
+
+    measure(stuCharClasses::ofScalar, "Scalar");
+    measure(stuCharClasses::of, "Dispatched");
+}
@@ -42,11 +42,11 @@ using namespace Targoman::Common;
 
 using  namespace Targoman::NLPLibs;
 
+void benchmarkNormalizerAllocations(const QStringList& _sentences, int _rounds);
+void benchmarkCharClasses(const QStringList& _sentences, int _rounds);
+
 int main(int _argc, char *_argv[])
 {
-    Q_UNUSED(_argc)
-    Q_UNUSED(_argv)
-
    try{
         qDebug()<<"sdklfdsklfjldsjk";
         Targoman::Common::Logger::instance().init("log.log");
@@ -136,6 +136,11 @@ int main(int _argc, char *_argv[])
             std::cout << OutputLine.toUtf8().constData() << std::endl;
         }
 
+        if (_argc > 1 && QString(_argv[1]) == "--bench-normalizer")
+            benchmarkNormalizerAllocations(Tests, _argc > 2 ? QString(_argv[2]).toInt() : 1000);
+        else if (_argc > 1 && QString(_argv[1]) == "--bench-char-classes")
+            benchmarkCharClasses(Tests, _argc > 2 ? QString(_argv[2]).toInt() : 100000);
+
 //        QString normalizedLine = Targoman::NLPLibs::TargomanTP::instance().text2IXML(line, "fa");
 
 
@@ -9,7 +9,8 @@
 # +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-#
 HEADERS =
 # +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-#
-SOURCES = main.cpp
+SOURCES = main.cpp \
+    benchNormalizer.cpp
 
 ################################################################################
 include($$QBUILD_PATH/templates/testConfigs.pri)
@@ -42,6 +42,16 @@ private slots:
     void ixml2Text();
     void text2RichIXML();
     void richIXML2Text();
+    void reload();
+    void collectUnknowns();
+    void text2Tokens();
+    void text2IXMLAlignment();
+    void ixmlTagList();
+    void pipelineStats();
+    void replacementSets();
+    void batch();
+    void stream();
+    void learnedRules();
 };
 
 #endif // UNITTEST_H
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+
+using namespace Targoman::NLPLibs;
+
+void UnitTest::batch()
+{
+    TargomanTextProcessor& TextProcessor = TargomanTextProcessor::instance();
+    QStringList Inputs;
+    Inputs << QStringLiteral("I have 2 apples.")
+           << QString()
+           << QStringLiteral("Send it to test@example.com on 12/01/2015.")
+           << QStringLiteral("\"Visit www.targoman.com\" he said!");
+    for (int i = 0; i < 64; ++i)
+        Inputs << QString("Line %1 has %2 words").arg(i).arg(i % 7);
+
+    QVector<stuText2IXMLResult> Results = TextProcessor.text2IXMLBatch(Inputs, "en", false);
+    QCOMPARE(Results.size(), Inputs.size());
+    QStringList IXMLs;
+    for (int i = 0; i < Inputs.size(); ++i){
+        bool SpellCorrected = false;
+        stuIXMLTagList Tags;
+        QCOMPARE(Results.at(i).IXML, TextProcessor.text2IXML(Inputs.at(i), SpellCorrected, Tags, "en",
+                                                             static_cast<quint32>(i), false, false));
+        QCOMPARE(Results.at(i).SpellCorrected, SpellCorrected);
+        QCOMPARE(Results.at(i).Tags.toVariantList(), Tags.toVariantList());
+        IXMLs.append(Results.at(i).IXML);
+    }
+
+    int ThreadCount = TextProcessor.batchThreadCount();
+    TextProcessor.setBatchThreadCount(3);
+    QCOMPARE(TextProcessor.batchThreadCount(), 3);
+    QStringList Texts = TextProcessor.ixml2TextBatch(IXMLs);
+    QCOMPARE(Texts.size(), IXMLs.size());
+    for (int i = 0; i < IXMLs.size(); ++i)
+        QCOMPARE(Texts.at(i), TextProcessor.ixml2Text(IXMLs.at(i)));
+    TextProcessor.setBatchThreadCount(ThreadCount);
+
+    QVERIFY(TextProcessor.text2IXMLBatch(QStringList()).isEmpty());
+    stuText2IXMLOptions Options;
+    Options.ReplacementSet = 0xFFFFFFFF;
+    QVERIFY_EXCEPTION_THROWN(TextProcessor.text2IXMLBatch(Inputs, Options), exTextProcessor);
+}
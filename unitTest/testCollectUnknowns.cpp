@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+
+void UnitTest::collectUnknowns()
+{
+    Targoman::NLPLibs::TargomanTextProcessor& TextProcessor = Targoman::NLPLibs::TargomanTextProcessor::instance();
+    TextProcessor.collectedUnknowns(true);
+    TextProcessor.setCollectUnknowns(true);
+    TextProcessor.normalizeText(QStringLiteral("\u1200 test \u1200"), false, "");
+    TextProcessor.setCollectUnknowns(false);
+    TextProcessor.normalizeText(QStringLiteral("\u1200"), false, "");
+
+    QVariantList Unknowns = TextProcessor.collectedUnknowns(true);
+    QVERIFY(Unknowns.size() > 0);
+    QVariantMap Unknown = Unknowns.first().toMap();
+    QCOMPARE(Unknown.value("type").toString(), QStringLiteral("Character"));
+    QCOMPARE(Unknown.value("codePoint").toUInt(), 0x1200u);
+    QCOMPARE(Unknown.value("count").toULongLong(), Q_UINT64_C(2));
+    QVERIFY(Unknown.value("sample").toString().contains(QStringLiteral("test")));
+
+    QVERIFY(TextProcessor.collectedUnknowns().isEmpty());
+}
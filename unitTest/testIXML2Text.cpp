@@ -35,5 +35,18 @@ void UnitTest::ixml2Text()
                             "this '12', \"I'm\" a test for \"me\" and you.\""));
     QVERIFY(VERIFY_IXML2TXT("این نیز بگذرد .",
                             "این نیز بگذرد."));
+    QVERIFY(VERIFY_IXML2TXT("I 'll go ( <number-1>7</number-1> ) .",
+                            "I'll go (7)."));
+    QVERIFY(VERIFY_IXML2TXT("x &lt; y &amp;gt; z",
+                            "x < y &gt; z"));
+    QVERIFY(VERIFY_IXML2TXT("\" a \" \" b \" ' c ' \" d",
+                            "\"a\" \"b\" 'c' \" d"));
+    QVERIFY(VERIFY_IXML2TXT("\" x\"y \" z \"",
+                            "\" x\"y \"z\""));
+    QVERIFY(VERIFY_IXML2TXT("\" a ' b \" c ' \" a ' b \" c '",
+                            "\"a 'b\" c' \"a 'b\" c'"));
+    QVERIFY(Targoman::NLPLibs::TargomanTextProcessor::instance().ixml2Text(
+                QStringLiteral("he said \" why ? \" and left . a . b ! c"), true, false, false, true) ==
+            QStringLiteral("he said \"why?\"\nand left.\na.\nb!\nc"));
 }
 
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+
+void UnitTest::ixmlTagList()
+{
+    Targoman::NLPLibs::TargomanTextProcessor& TextProcessor = Targoman::NLPLibs::TargomanTextProcessor::instance();
+    bool SpellCorrected;
+    QString Input = QStringLiteral("-12.5 \"x\" 13 me@test.com");
+
+    QVariantList Legacy;
+    QString LegacyIXML = TextProcessor.text2IXML(Input, SpellCorrected, "en", 0, false, true,
+                                                 QList<Targoman::NLPLibs::enuTextTags::Type>(),
+                                                 QList<Targoman::NLPLibs::stuIXMLReplacement>(),
+                                                 true, &Legacy, true, false, true, true);
+
+    Targoman::NLPLibs::stuIXMLTagList Tags;
+    QString IXML = TextProcessor.text2IXML(Input, SpellCorrected, Tags, "en", 0, false, true,
+                                           QList<Targoman::NLPLibs::enuTextTags::Type>(),
+                                           QList<Targoman::NLPLibs::stuIXMLReplacement>(),
+                                           true, false, true, true);
+
+    QCOMPARE(IXML, LegacyIXML);
+    QCOMPARE(Tags.Tags.size(), 3);
+    QCOMPARE(Tags.Tags.at(1).Type, Targoman::NLPLibs::enuTextTags::Number);
+    QCOMPARE(Tags.Tags.at(1).Index, 1);
+    QCOMPARE(Tags.value(1).toString(), QStringLiteral("13"));
+    QCOMPARE(Tags.tagName(1), QStringLiteral("<number-1>"));
+    QCOMPARE(Tags.toVariantList(), Legacy);
+    QCOMPARE(Tags.toJson(), QJsonDocument(QJsonArray::fromVariantList(Legacy)).toJson(QJsonDocument::Compact));
+
+    // Tag names are lower case whether they are indexed or not
+    Legacy.clear();
+    LegacyIXML = TextProcessor.text2IXML(QStringLiteral("13"), SpellCorrected, "en", 0, false, true,
+                                         QList<Targoman::NLPLibs::enuTextTags::Type>(),
+                                         QList<Targoman::NLPLibs::stuIXMLReplacement>(),
+                                         true, &Legacy);
+    QCOMPARE(LegacyIXML, QStringLiteral("<number>13</number>"));
+    QCOMPARE(Legacy.size(), 1);
+    QCOMPARE(Legacy.at(0).toMap().value("t").toString(), QStringLiteral("<number>"));
+}
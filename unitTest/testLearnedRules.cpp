@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+
+#include "UnitTest.h"
+#include "libTargomanTextProcessor/Private/LearnedRulesJournal.h"
+
+using namespace Targoman::NLPLibs;
+using namespace Targoman::NLPLibs::TargomanTP::Private;
+
+/**
+ * @brief copies all files of _from directory and its sub directories to _to.
+ */
+static bool copyDir(const QString& _from, const QString& _to)
+{
+    QDir From(_from);
+    if (!QDir().mkpath(_to))
+        return false;
+    foreach (const QFileInfo& Entry, From.entryInfoList(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot))
+        if (Entry.isDir() ? !copyDir(Entry.absoluteFilePath(), _to + "/" + Entry.fileName()) :
+                            !QFile::copy(Entry.absoluteFilePath(), _to + "/" + Entry.fileName()))
+            return false;
+    return true;
+}
+
+static QByteArray readFile(const QString& _filePath)
+{
+    QFile File(_filePath);
+    return File.open(QIODevice::ReadOnly) ? File.readAll() : QByteArray();
+}
+
+void UnitTest::learnedRules()
+{
+    QTemporaryDir TempDir;
+    QVERIFY(TempDir.isValid());
+
+    // Journal keeps fields with separators and ignores a torn last line
+    QString JournalPath = TempDir.path() + "/Test.journal";
+    {
+        LearnedRulesJournal Journal;
+        Journal.setFilePath(JournalPath);
+        Journal.append(stuLearnedRule("Section", QStringLiteral("a\tb\nc"), QStringLiteral("d\\t\re")));
+        Journal.append(stuLearnedRule("Section", "Key"));
+        Journal.sync();
+    }
+    QFile Torn(JournalPath);
+    QVERIFY(Torn.open(QIODevice::WriteOnly | QIODevice::Append));
+    QVERIFY(Torn.write("Section\tTorn") > 0);
+    Torn.close();
+
+    LearnedRulesJournal Journal;
+    Journal.setFilePath(JournalPath);
+    QList<stuLearnedRule> Rules = Journal.replay();
+    QCOMPARE(Rules.size(), 2);
+    QCOMPARE(Rules.at(0).Section, QStringLiteral("Section"));
+    QCOMPARE(Rules.at(0).Key, QStringLiteral("a\tb\nc"));
+    QCOMPARE(Rules.at(0).Value, QStringLiteral("d\\t\re"));
+    QCOMPARE(Rules.at(1).Key, QStringLiteral("Key"));
+    QVERIFY(Rules.at(1).Value.isEmpty());
+    Journal.clear();
+    QVERIFY(Journal.replay().isEmpty());
+
+    // Learned rules are replayed by rules loaded from a copy of config files
+    QDir ApplicationDir(QCoreApplication::applicationDirPath());
+    QString ConfDir = TempDir.path() + "/conf";
+    QVERIFY(copyDir(ApplicationDir.absoluteFilePath("../../libsrc/conf"), ConfDir));
+
+    TargomanTextProcessor::stuConfigs Configs;
+    Configs.NormalizationFile = ConfDir + "/Normalization.conf";
+    Configs.AbbreviationsFile = ConfDir + "/Abbreviations.tbl";
+    Configs.SpellCorrectorBaseConfigPath = ConfDir + "/SpellCorrectors";
+    QVariantHash PersianSpellCorrector;
+    PersianSpellCorrector.insert("Active", true);
+    Configs.SpellCorrectorLanguageBasedConfigs.insert("fa", PersianSpellCorrector);
+
+    QString NormalizationJournalPath = Configs.NormalizationFile + ".journal";
+    QString SpellJournalPath = ConfDir + "/SpellCorrectors/Persian/Learned.journal";
+    auto writeJournals = [&] () {
+        LearnedRulesJournal NormalizationJournal;
+        NormalizationJournal.setFilePath(NormalizationJournalPath);
+        NormalizationJournal.append(stuLearnedRule("ReplacingCharacters", "<0x0180>", "<0x62>"));
+        NormalizationJournal.sync();
+        LearnedRulesJournal SpellJournal;
+        SpellJournal.setFilePath(SpellJournalPath);
+        SpellJournal.append(stuLearnedRule("AutoCorrectTerms", QStringLiteral("تستی‌غلط"), QStringLiteral("تستی")));
+        SpellJournal.sync();
+    };
+    writeJournals();
+
+    TargomanTextProcessor& TextProcessor = TargomanTextProcessor::instance();
+    QVERIFY(TextProcessor.reload(Configs));
+    QCOMPARE(TextProcessor.normalizeText(QStringLiteral("aƀc"), false, "fa"), QStringLiteral("abc"));
+
+    // Compaction moves rules to their own sections and clears journals, compacting same rules again adds nothing
+    QByteArray NormalizationLine = QStringLiteral("NEW ƀ = b").toUtf8();
+    QByteArray SpellLine = QStringLiteral("NEW تستی‌غلط = تستی").toUtf8();
+    for (int Round = 0; Round < 2; ++Round){
+        if (Round)
+            writeJournals();
+        TextProcessor.compactLearnedRules();
+        QCOMPARE(QFileInfo(NormalizationJournalPath).size(), Q_INT64_C(0));
+        QCOMPARE(QFileInfo(SpellJournalPath).size(), Q_INT64_C(0));
+
+        QByteArray Normalization = readFile(Configs.NormalizationFile);
+        QCOMPARE(Normalization.count(NormalizationLine), 1);
+        int Line = Normalization.indexOf(NormalizationLine);
+        QVERIFY(Normalization.mid(Normalization.lastIndexOf("\n[", Line)).startsWith("\n[ReplacingCharacters]"));
+
+        QByteArray AutoCorrectTerms = readFile(ConfDir + "/SpellCorrectors/Persian/AutoCorrectTerms.tbl");
+        QCOMPARE(AutoCorrectTerms.count(SpellLine), 1);
+    }
+
+    // Compacted rules are loaded from config files
+    QVERIFY(TextProcessor.reload(Configs));
+    QCOMPARE(TextProcessor.normalizeText(QStringLiteral("aƀc"), false, "fa"), QStringLiteral("abc"));
+
+    Configs.NormalizationFile = ApplicationDir.absoluteFilePath("../../libsrc/conf/Normalization.conf");
+    Configs.AbbreviationsFile = ApplicationDir.absoluteFilePath("../../libsrc/conf/Abbreviations.tbl");
+    Configs.SpellCorrectorBaseConfigPath = ApplicationDir.absoluteFilePath("../../libsrc/conf/SpellCorrectors");
+    QVERIFY(TextProcessor.reload(Configs));
+}
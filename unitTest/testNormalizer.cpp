@@ -190,6 +190,20 @@ void UnitTest::normalizeText()
                             "اشغال"
                             ));
 
+    // Supplementary plane characters must be normalized as a whole not as separate surrogates
+    QVERIFY(VERIFY_NORMALIZE("",
+                            "سلام 😀",
+                            "سلام 😀"
+                            ));
+    QVERIFY(VERIFY_NORMALIZE("",
+                            "𝐓𝐞𝐱𝐭 𝟏𝟐",
+                            "Text 12"
+                            ));
+    QVERIFY(VERIFY_NORMALIZE("",
+                            "𠀀𠀁",
+                            "𠀀𠀁"
+                            ));
+
 /*    QVERIFY(VERIFY_NORMALIZE("fa",
                             "از تاثیر مثبت این خاطره هم کاری برنیامده است",
                             "از تاثیر مثبت این خاطره هم کاری برنیامده است"
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+#include "UnitTest.h"
+
+void UnitTest::pipelineStats()
+{
+    Targoman::NLPLibs::TargomanTextProcessor& TextProcessor = Targoman::NLPLibs::TargomanTextProcessor::instance();
+    QList<Targoman::NLPLibs::enuTextTags::Type> RemovingTags;
+    RemovingTags.append(Targoman::NLPLibs::enuTextTags::URL);
+    bool SpellCorrected;
+
+    TextProcessor.pipelineStats(true);
+    TextProcessor.setPipelineProfiling(true);
+    QCOMPARE(TextProcessor.text2IXML(QStringLiteral("a Amazon.com b"), SpellCorrected, "en", 0, false, true, RemovingTags),
+             QStringLiteral("a Amazon.com b"));
+    QCOMPARE(TextProcessor.text2IXML(QStringLiteral("a Amazon.com b"), SpellCorrected, "en", 0, false, true, RemovingTags,
+                                     QList<Targoman::NLPLibs::stuIXMLReplacement>(), false, NULL, true, false, true, false,
+                                     NULL, false),
+             QStringLiteral("a Amazon . com b"));
+    TextProcessor.setPipelineProfiling(false);
+
+    // Ordinals are rendered without tag, so removing their tag must not stop detecting them
+    QList<Targoman::NLPLibs::enuTextTags::Type> RemovingOrdinals;
+    RemovingOrdinals.append(Targoman::NLPLibs::enuTextTags::Ordinals);
+    QString Ordinal = TextProcessor.text2IXML(QStringLiteral("a 21st b"), SpellCorrected, "en", 0, false, true);
+    QVERIFY(Ordinal.contains(QStringLiteral("21st")));
+    QCOMPARE(TextProcessor.text2IXML(QStringLiteral("a 21st b"), SpellCorrected, "en", 0, false, true, RemovingOrdinals,
+                                     QList<Targoman::NLPLibs::stuIXMLReplacement>(), false, NULL, true, false, true, false,
+                                     NULL, false),
+             Ordinal);
+
+    bool Found = false;
+    foreach(const Targoman::NLPLibs::stuPipelineStageStats& Stage, TextProcessor.pipelineStats(true))
+        if (Stage.Name == QStringLiteral("URL")){
+            QVERIFY(Stage.Calls > 0);
+            QVERIFY(Stage.Skipped > 0);
+            QVERIFY(Stage.Matches > 0);
+            Found = true;
+        }
+    QVERIFY(Found);
+
+    foreach(const Targoman::NLPLibs::stuPipelineStageStats& Stage, TextProcessor.pipelineStats())
+        QCOMPARE(Stage.Calls, Q_UINT64_C(0));
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+
+void UnitTest::reload()
+{
+    Targoman::NLPLibs::TargomanTextProcessor& TextProcessor = Targoman::NLPLibs::TargomanTextProcessor::instance();
+    bool SpellCorrected;
+    QString Before = TextProcessor.text2IXML(QStringLiteral("a U.S. A.B.C.D سلام12"), SpellCorrected, "fa", 0, false);
+    quint64 Version = TextProcessor.rulesVersion();
+    QVERIFY(Version > 0);
+
+    QVERIFY(TextProcessor.reload());
+    QCOMPARE(TextProcessor.rulesVersion(), Version + 1);
+    QVERIFY(TextProcessor.lastReloadDuration() >= 0);
+    QCOMPARE(TextProcessor.text2IXML(QStringLiteral("a U.S. A.B.C.D سلام12"), SpellCorrected, "fa", 0, false), Before);
+}
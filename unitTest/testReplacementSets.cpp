@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+#include "UnitTest.h"
+
+using namespace Targoman::NLPLibs;
+
+void UnitTest::replacementSets()
+{
+    TargomanTextProcessor& TextProcessor = TargomanTextProcessor::instance();
+    QList<stuIXMLReplacement> Replacements;
+    Replacements.append(stuIXMLReplacement(QRegularExpression("<number>"), "<N>"));
+    Replacements.append(stuIXMLReplacement(QRegularExpression("</number>"), "</N>"));
+    Replacements.append(stuIXMLReplacement(QRegularExpression("([0-9]+)"), "#\\1"));
+    Replacements.append(stuIXMLReplacement(QRegularExpression("bc"), "Y"));
+    Replacements.append(stuIXMLReplacement(QRegularExpression("ab"), "X"));
+
+    quint32 Handle = TextProcessor.registerReplacements(Replacements);
+    QVERIFY(Handle != 0);
+
+    bool SpellCorrected;
+    QString Input = QStringLiteral("abc 12 b");
+    QString Expected = QStringLiteral("aY <N>#12</N> b");
+    QCOMPARE(TextProcessor.text2IXML(Input, SpellCorrected, "en", 0, false, false, QList<enuTextTags::Type>(),
+                                     Replacements),
+             Expected);
+    stuText2IXMLOptions Options;
+    Options.Lang = "en";
+    Options.UseSpellCorrector = false;
+    Options.ReplacementSet = Handle;
+    stuIXMLTagList Tags;
+    QCOMPARE(TextProcessor.text2IXML(Input, SpellCorrected, Tags, Options), Expected);
+    QCOMPARE(TextProcessor.text2IXMLBatch(QStringList() << Input, Options).first().IXML, Expected);
+
+    QVERIFY(TextProcessor.unregisterReplacements(Handle));
+    QVERIFY(TextProcessor.unregisterReplacements(Handle) == false);
+    QVERIFY_EXCEPTION_THROWN(TextProcessor.text2IXML(Input, SpellCorrected, Tags, Options), exTextProcessor);
+}
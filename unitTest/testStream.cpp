@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include <QBuffer>
+#include "UnitTest.h"
+
+using namespace Targoman::NLPLibs;
+
+void UnitTest::stream()
+{
+    TargomanTextProcessor& TextProcessor = TargomanTextProcessor::instance();
+    QStringList Inputs;
+    Inputs << QStringLiteral("I have 2 apples.")
+           << QString()
+           << QStringLiteral("Send it to test@example.com on 12/01/2015.");
+    for (int i = 0; i < 1000; ++i)
+        Inputs << QString("Line %1 has %2 words").arg(i).arg(i % 7);
+
+    QByteArray InputData = Inputs.join("\r\n").toUtf8();
+    QBuffer Input(&InputData), Output;
+    Input.open(QIODevice::ReadOnly);
+    Output.open(QIODevice::WriteOnly);
+    QCOMPARE(TextProcessor.text2IXMLStream(Input, Output, "en", false), static_cast<quint64>(Inputs.size()));
+
+    QStringList IXMLs;
+    for (int i = 0; i < Inputs.size(); ++i){
+        bool SpellCorrected;
+        IXMLs.append(TextProcessor.text2IXML(Inputs.at(i), SpellCorrected, "en", static_cast<quint32>(i), false,
+                                             false));
+    }
+    QCOMPARE(QString::fromUtf8(Output.data()), IXMLs.join('\n') + '\n');
+
+    QByteArray IXMLData = Output.data();
+    QBuffer IXMLInput(&IXMLData), TextOutput;
+    IXMLInput.open(QIODevice::ReadOnly);
+    TextOutput.open(QIODevice::WriteOnly);
+    QCOMPARE(TextProcessor.ixml2TextStream(IXMLInput, TextOutput), static_cast<quint64>(IXMLs.size()));
+    QStringList Texts;
+    foreach(const QString& IXML, IXMLs)
+        Texts.append(TextProcessor.ixml2Text(IXML));
+    QCOMPARE(QString::fromUtf8(TextOutput.data()), Texts.join('\n') + '\n');
+
+    QBuffer Closed;
+    QVERIFY_EXCEPTION_THROWN(TextProcessor.text2IXMLStream(Closed, Output), exTextProcessor);
+}
@@ -77,6 +77,8 @@ void UnitTest::text2IXML()
     QVERIFY(VERIFY_TXT2IXML("en","Amazon.com", "<URL>Amazon.com</URL>"));
     QVERIFY(VERIFY_TXT2IXML("en","1.Amazon.com", "<OrderedListItem>1.</OrderedListItem> <URL>Amazon.com</URL>"));
     QVERIFY(VERIFY_TXT2IXML("fa","آمازون.کام", "<URL>آمازون.کام</URL>"));
+    QVERIFY(VERIFY_TXT2IXML("en","a 192.168.1.1 b", "a <url>192.168.1.1</url> b"));
+    QVERIFY(VERIFY_TXT2IXML("en","see http://example.com:8080/a/b now", "see <url>http://example.com:8080/a/b</url> now"));
 
     //QVERIFY(VERIFY_TXT2IXML("en","Resources and Irrigation Dr.MMahmoud Abu-Zaid.", "Resources and Irrigation <Abbreviation>Dr.</Abbreviation> MMahmoud Abu - Zaid ."));
     QVERIFY(VERIFY_TXT2IXML("en","Resources and Irrigation Dr. MMahmoud Abu-Zaid.", "Resources and Irrigation <Abbreviation>Dr.</Abbreviation> MMahmoud Abu - Zaid ."));
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+
+void UnitTest::text2IXMLAlignment()
+{
+    bool SpellCorrected;
+    QVector<Targoman::NLPLibs::stuTextAlignment> Alignment;
+    QString Input = QStringLiteral("a asd-12 to me@test.com.");
+    QString IXML = Targoman::NLPLibs::TargomanTextProcessor::instance().text2IXML(
+                       Input, SpellCorrected, "en", 0, false, false,
+                       QList<Targoman::NLPLibs::enuTextTags::Type>(),
+                       QList<Targoman::NLPLibs::stuIXMLReplacement>(),
+                       false, NULL, true, false, true, false,
+                       &Alignment);
+
+    QCOMPARE(IXML, QStringLiteral("a asd - <number>12</number> to <email>me@test.com</email> ."));
+    QCOMPARE(Alignment.size(), 7);
+    foreach (const Targoman::NLPLibs::stuTextAlignment& Item, Alignment)
+        QCOMPARE(IXML.mid(Item.OutputOffset, Item.OutputLength).contains(Input.mid(Item.SourceOffset, Item.SourceLength)), true);
+    QCOMPARE(Alignment.at(2).SourceOffset, 5);
+    QCOMPARE(IXML.mid(Alignment.at(3).OutputOffset, Alignment.at(3).OutputLength), QStringLiteral("<number>12</number>"));
+    QCOMPARE(Input.mid(Alignment.at(3).SourceOffset, Alignment.at(3).SourceLength), QStringLiteral("12"));
+    QCOMPARE(Input.mid(Alignment.at(5).SourceOffset, Alignment.at(5).SourceLength), QStringLiteral("me@test.com"));
+    QCOMPARE(Alignment.at(6).SourceOffset, 23);
+}
@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Targoman: A robust Machine Translation framework               *
+ *                                                                            *
+ * Copyright 2014-2018 by ITRC <http://itrc.ac.ir>                            *
+ *                                                                            *
+ * This file is part of Targoman.                                             *
+ *                                                                            *
+ * Targoman is free software: you can redistribute it and/or modify           *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * Targoman is distributed in the hope that it will be useful,                *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with Targoman. If not, see <http://www.gnu.org/licenses/>.           *
+ *                                                                            *
+ ******************************************************************************/
+/**
+ * @author S. Mohammad M. Ziabary <ziabary@targoman.com>
+ * @author Behrooz Vedadian <vedadian@targoman.com>
+ * @author Saeed Torabzadeh <saeed.torabzadeh@targoman.com>
+ */
+
+#include "UnitTest.h"
+
+void UnitTest::text2Tokens()
+{
+    Targoman::NLPLibs::TargomanTextProcessor& TextProcessor = Targoman::NLPLibs::TargomanTextProcessor::instance();
+    bool SpellCorrected;
+
+    Targoman::NLPLibs::stuTokenStream Stream =
+            TextProcessor.text2Tokens(QStringLiteral("a asd-12 to me@test.com."), SpellCorrected, "en", 0, false);
+    QCOMPARE(Stream.Buffer, QStringLiteral("a asd - 12 to me@test.com ."));
+    QCOMPARE(Stream.Tokens.size(), 7);
+    QCOMPARE(Stream.text(3).toString(), QStringLiteral("12"));
+    QCOMPARE(Stream.Tokens.at(3).Tag, Targoman::NLPLibs::enuTextTags::Number);
+    QCOMPARE(Stream.text(5).toString(), QStringLiteral("me@test.com"));
+    QCOMPARE(Stream.Tokens.at(5).Tag, Targoman::NLPLibs::enuTextTags::Email);
+    QCOMPARE(Stream.Tokens.at(0).Tag, Targoman::NLPLibs::enuTextTags::Unknown);
+    QCOMPARE(Stream.Tokens.at(2).SourceOffset, 5);
+    QCOMPARE(Stream.Tokens.at(3).SourceOffset, 6);
+    QCOMPARE(Stream.Tokens.at(3).SourceLength, 2);
+    QCOMPARE(Stream.Tokens.at(5).SourceOffset, 12);
+    QCOMPARE(Stream.Tokens.at(5).SourceLength, 11);
+    QVERIFY(SpellCorrected == false);
+    foreach (const Targoman::NLPLibs::stuTextToken& Token, Stream.Tokens)
+        QVERIFY(Token.SpellCorrected == false);
+
+    QVERIFY(TextProcessor.text2Tokens(QStringLiteral("  "), SpellCorrected).Tokens.isEmpty());
+}
@@ -15,6 +15,16 @@ SOURCES = \
     testIXML2Text.cpp \
     testText2RichIXML.cpp \
     testRichIXML2Text.cpp \
+    testReload.cpp \
+    testCollectUnknowns.cpp \
+    testText2Tokens.cpp \
+    testText2IXMLAlignment.cpp \
+    testIXMLTagList.cpp \
+    testPipelineStats.cpp \
+    testReplacementSets.cpp \
+    testBatch.cpp \
+    testStream.cpp \
+    testLearnedRules.cpp \
     UnitTest.cpp
 
 ################################################################################